@@ -0,0 +1,123 @@
+/************************************************************
+MG2639_Binary_Telemetry.ino
+MG2639 Cellular Shield library - Binary Telemetry Example
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This example demonstrates how to use MG2639_Encoder to send
+the six analog inputs to a server as a compact CBOR record.
+
+The record is written straight into the TCP link through a
+small buffer, instead of building a text HTTP request in
+RAM. Six readings take at most 19 bytes, compared to ~270
+bytes for the same post in the MG2639_Phant_Example.
+
+Your server needs to decode CBOR - most languages have a
+library for it (e.g. Python's cbor2).
+
+Functions shown in this example include:
+  MG2639_Encoder encoder(gprs) - Create an encoder that
+    writes to the TCP link.
+  encoder.beginArray(count) - Start an array.
+  encoder.addUInt(value) - Add a value.
+  encoder.end() - Send the record.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun 
+employee) at the local, and you've found our code helpful, 
+please buy us a round!
+
+Distributed as-is; no warranty is given.
+************************************************************/
+// The SparkFun MG2639 Cellular Shield uses SoftwareSerial
+// to communicate with the MG2639 module. Include that
+// library first:
+#include <SoftwareSerial.h>
+// Include the MG2639 Cellular Shield library
+#include <SFE_MG2639_CellShield.h>
+
+// Destination server and port. Replace these with your own
+// TCP listener.
+const char server[] = "example.com";
+const unsigned int serverPort = 5000;
+
+// Send a record every SEND_INTERVAL milliseconds
+#define SEND_INTERVAL 60000
+unsigned long lastSend = 0;
+
+void setup() 
+{
+  Serial.begin(9600);
+  
+  // Call cell.begin() to turn the module on and verify
+  // communication.
+  int beginStatus = cell.begin();
+  if (beginStatus <= 0)
+  {
+    Serial.println(F("Unable to communicate with shield. Looping"));
+    while(1)
+      ;
+  }
+  
+  // gprs.open() enables GPRS.
+  int openStatus = gprs.open();
+  if (openStatus <= 0)
+  {
+    Serial.println(F("Unable to open GPRS. Looping"));
+    while (1)
+      ;
+  }
+  
+  // Connect to the server once, and send every record over
+  // the same connection.
+  if (gprs.connect(server, serverPort) <= 0)
+  {
+    Serial.println(F("Unable to connect. Looping"));
+    while (1)
+      ;
+  }
+  Serial.println(F("Connected!"));
+}
+
+void loop()
+{
+  if ((lastSend == 0) || (millis() - lastSend >= SEND_INTERVAL))
+  {
+    sendReadings();
+    lastSend = millis();
+  }
+}
+
+void sendReadings()
+{
+  // The encoder only needs ENCODER_BUFFER_SIZE bytes of RAM,
+  // so it can live on the stack.
+  MG2639_Encoder encoder(gprs);
+  
+  // An array of six unsigned integers: [a0, a1, ... a5]
+  encoder.beginArray(6);
+  encoder.addUInt(analogRead(A0));
+  encoder.addUInt(analogRead(A1));
+  encoder.addUInt(analogRead(A2));
+  encoder.addUInt(analogRead(A3));
+  encoder.addUInt(analogRead(A4));
+  encoder.addUInt(analogRead(A5));
+  
+  // encoder.end() sends the record, and returns the number
+  // of bytes sent.
+  int sent = encoder.end();
+  if (sent > 0)
+  {
+    Serial.print(F("Sent "));
+    Serial.print(sent);
+    Serial.println(F(" bytes."));
+  }
+  else
+  {
+    Serial.println(F("Send failed."));
+  }
+}
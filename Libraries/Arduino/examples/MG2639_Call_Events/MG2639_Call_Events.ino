@@ -0,0 +1,122 @@
+/************************************************************
+MG2639_Call_Events.ino
+MG2639 Cellular Shield library - Call Events Example
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This example demonstrates how to follow phone calls through
+events, instead of polling the module's call status. Each
+incoming call is printed with the caller's number, answered,
+and hung up after 20 seconds. Every event is printed with
+the time since the call started ringing.
+
+On a board with a spare interrupt pin (e.g. pin 18 on a
+Mega), wire the shield's RING output (A0) to it and set
+RING_INTERRUPT_PIN below. Calls are then timed from the
+moment RING goes low. On an Uno, leave it at -1.
+
+Functions shown in this example include:
+  phone.enableCallerID() - Send the caller's number with
+    each ring.
+  phone.attachRing(pin) - Timestamp rings with an interrupt.
+  phone.poll(fn) - Pass incoming, answered and ended events
+    to fn.
+  phone.answer() - Pick up a ringing call.
+  phone.hangUp() - Hang up a call.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun 
+employee) at the local, and you've found our code helpful, 
+please buy us a round!
+
+Distributed as-is; no warranty is given.
+************************************************************/
+// The SparkFun MG2639 Cellular Shield uses SoftwareSerial
+// to communicate with the MG2639 module. Include that
+// library first:
+#include <SoftwareSerial.h>
+// Include the MG2639 Cellular Shield library
+#include <SFE_MG2639_CellShield.h>
+
+// Interrupt pin RING is wired to, or -1 if it isn't.
+const int RING_INTERRUPT_PIN = -1;
+
+// How long (ms) to stay on each call
+const unsigned long CALL_LENGTH = 20000;
+
+// Set when a call should be answered, and when it was.
+bool answerCall = false;
+unsigned long answerTime = 0;
+
+void setup() 
+{
+  Serial.begin(9600);
+  
+  // Call cell.begin() to turn the module on and verify
+  // communication.
+  int beginStatus = cell.begin();
+  if (beginStatus <= 0)
+  {
+    Serial.println(F("Unable to communicate with shield. Looping"));
+    while(1)
+      ;
+  }
+  // Delay a bit. If phone was off, it takes a couple seconds
+  // to set up SIM.
+  delay(2000);
+  
+  phone.setAudioChannel(AUDIO_CHANNEL_DIFFERENTIAL);
+  // "+CLIP: " after each RING gives the caller's number.
+  if (phone.enableCallerID() <= 0)
+    Serial.println(F("Couldn't turn on caller ID."));
+  if (RING_INTERRUPT_PIN >= 0)
+    phone.attachRing(RING_INTERRUPT_PIN);
+  
+  Serial.println(F("Call me!"));
+}
+
+void loop() 
+{
+  // Events come from what the module sends, so poll often.
+  phone.poll(printEvent);
+  
+  // Answer outside of the callback - poll() is still
+  // reading the module's output while it's called.
+  if (answerCall)
+  {
+    answerCall = false;
+    phone.answer();
+  }
+  if ((phone.getState() == CALL_ACTIVE) &&
+      (millis() - answerTime > CALL_LENGTH))
+  {
+    phone.hangUp();
+  }
+}
+
+// printEvent() is called for each change in a call.
+void printEvent(call_event event, const char * number, unsigned long latency)
+{
+  if (event == CALL_EVENT_INCOMING)
+  {
+    Serial.print(F("Incoming call from "));
+    Serial.print(number[0] != '\0' ? number : "unknown");
+    answerCall = true;
+  }
+  else if (event == CALL_EVENT_ANSWERED)
+  {
+    Serial.print(F("Answered"));
+    answerTime = millis();
+  }
+  else
+  {
+    Serial.print(F("Ended"));
+  }
+  Serial.print(F(", "));
+  Serial.print(latency);
+  Serial.println(F(" ms after the first ring"));
+}
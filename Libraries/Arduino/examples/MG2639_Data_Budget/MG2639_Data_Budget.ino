@@ -0,0 +1,127 @@
+/************************************************************
+MG2639_Data_Budget.ino
+MG2639 Cellular Shield library - Data Usage Example
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This example demonstrates how to keep a metered SIM within
+a monthly data budget.
+
+The library counts every byte sent and received over GPRS,
+plus an estimate of the TCP/IP headers around them. The
+total is kept in EEPROM, so it survives resets. Readings
+are sent over UDP once a minute while under the soft limit,
+once an hour past it, and not at all past the hard limit.
+Send 'r' over the Serial Monitor to start a new month.
+
+Functions shown in this example include:
+  gprs.setUsageStorage(storage) - Keep the total in EEPROM.
+  gprs.setQuota(soft, hard) - Set the budget.
+  gprs.quotaStatus() - Check it.
+  gprs.totalUsage(), gprs.sessionUsage() - Read counters.
+  gprs.resetUsage() - Start a new billing period.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun 
+employee) at the local, and you've found our code helpful, 
+please buy us a round!
+
+Distributed as-is; no warranty is given.
+************************************************************/
+// The SparkFun MG2639 Cellular Shield uses SoftwareSerial
+// to communicate with the MG2639 module. Include that
+// library first:
+#include <SoftwareSerial.h>
+// Include the MG2639 Cellular Shield library
+#include <SFE_MG2639_CellShield.h>
+
+// Destination server and port. Replace these with your own
+// UDP listener.
+IPAddress serverIP(204, 144, 132, 37);
+const unsigned int serverPort = 5000;
+
+// Monthly budget, in bytes. Past the soft limit, readings
+// are sent less often. Past the hard limit, nothing is sent.
+const unsigned long softLimit = 4500000;
+const unsigned long hardLimit = 5000000;
+
+// The usage total takes USAGE_STORAGE_SIZE (38) bytes of
+// EEPROM, from address 0.
+MG2639_EEPROMStorage usageStorage(0, USAGE_STORAGE_SIZE);
+
+unsigned long lastSend = 0;
+
+void setup() 
+{
+  Serial.begin(9600);
+  
+  // Load the total saved before the last reset.
+  if (gprs.setUsageStorage(usageStorage) <= 0)
+    Serial.println(F("No saved usage, starting from 0."));
+  gprs.setQuota(softLimit, hardLimit);
+  printUsage();
+  
+  // Call cell.begin() to turn the module on and verify
+  // communication.
+  int beginStatus = cell.begin();
+  if (beginStatus <= 0)
+  {
+    Serial.println(F("Unable to communicate with shield. Looping"));
+    while(1)
+      ;
+  }
+  
+  // gprs.open() enables GPRS.
+  int openStatus = gprs.open();
+  if (openStatus <= 0)
+  {
+    Serial.println(F("Unable to open GPRS. Looping"));
+    while (1)
+      ;
+  }
+}
+
+void loop()
+{
+  unsigned long interval = 60000; // Once a minute
+  
+  if (gprs.quotaStatus() == QUOTA_SOFT)
+    interval = 3600000; // Once an hour
+  
+  if ((gprs.quotaStatus() != QUOTA_HARD) && 
+      ((lastSend == 0) || (millis() - lastSend >= interval)))
+  {
+    if (udp.beginPacket(serverIP, serverPort) > 0)
+    {
+      udp.print(analogRead(A0));
+      udp.endPacket();
+    }
+    lastSend = millis();
+    printUsage();
+  }
+  
+  // Send 'r' to reset the total at the start of the month
+  if (Serial.available() && (Serial.read() == 'r'))
+  {
+    gprs.resetUsage();
+    printUsage();
+  }
+}
+
+void printUsage()
+{
+  gprs_usage total = gprs.totalUsage();
+  gprs_usage session = gprs.sessionUsage();
+  
+  Serial.print(F("This month: "));
+  Serial.print(total.payloadSent + total.payloadReceived);
+  Serial.print(F(" bytes of data, ~"));
+  Serial.print(total.airSent + total.airReceived);
+  Serial.print(F(" on air. This session: ~"));
+  Serial.print(session.airSent + session.airReceived);
+  Serial.println(F(" on air."));
+}
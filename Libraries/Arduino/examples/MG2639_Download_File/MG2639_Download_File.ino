@@ -0,0 +1,103 @@
+/************************************************************
+MG2639_Download_File.ino
+MG2639 Cellular Shield library - Resumable Download Example
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This example demonstrates how to use MG2639_Download to
+fetch a file that's too big for RAM, and store it in
+non-volatile memory.
+
+The file is written to storage 32 bytes at a time as it
+arrives. If the link drops, the download picks up where it
+left off with an HTTP Range request. When it's done, the
+CRC-32 of the file is checked.
+
+This example stores a configuration file in the Arduino's
+EEPROM (up to 1 KB on an Uno). For firmware images, derive
+a class from MG2639_Storage that writes to SPI flash or an
+SD card instead.
+
+Functions shown in this example include:
+  download.get(host, path) - Download (and resume) a file.
+  download.verify(crc) - Check the file's CRC-32.
+  download.getSize(), download.getAttempts(),
+    download.getThroughput() - Download statistics.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun 
+employee) at the local, and you've found our code helpful, 
+please buy us a round!
+
+Distributed as-is; no warranty is given.
+************************************************************/
+// The SparkFun MG2639 Cellular Shield uses SoftwareSerial
+// to communicate with the MG2639 module. Include that
+// library first:
+#include <SoftwareSerial.h>
+// Include the MG2639 Cellular Shield library
+#include <SFE_MG2639_CellShield.h>
+
+// Server and path of the file to download. Replace these
+// with your own.
+const char server[] = "example.com";
+const char path[] = "/config.bin";
+// CRC-32 of the file. On Linux, get it with "crc32 config.bin"
+const uint32_t fileCRC = 0x12345678;
+
+// Store the file in the first 1024 bytes of EEPROM
+MG2639_EEPROMStorage storage(0, 1024);
+MG2639_Download download(storage);
+
+void setup() 
+{
+  Serial.begin(9600);
+  
+  // Call cell.begin() to turn the module on and verify
+  // communication.
+  int beginStatus = cell.begin();
+  if (beginStatus <= 0)
+  {
+    Serial.println(F("Unable to communicate with shield. Looping"));
+    while(1)
+      ;
+  }
+  
+  // gprs.open() enables GPRS.
+  int openStatus = gprs.open();
+  if (openStatus <= 0)
+  {
+    Serial.println(F("Unable to open GPRS. Looping"));
+    while (1)
+      ;
+  }
+  
+  // download.get() returns once the whole file is stored, or
+  // it has failed DOWNLOAD_MAX_ATTEMPTS times.
+  Serial.println(F("Downloading..."));
+  int status = download.get(server, path);
+  
+  Serial.print(download.getOffset());
+  Serial.print(F(" of "));
+  Serial.print(download.getSize());
+  Serial.print(F(" bytes in "));
+  Serial.print(download.getAttempts());
+  Serial.print(F(" request(s), "));
+  Serial.print(download.getThroughput());
+  Serial.println(F(" bytes/s"));
+  
+  if (status <= 0)
+    Serial.println(F("Download failed."));
+  else if (download.verify(fileCRC))
+    Serial.println(F("CRC good!"));
+  else
+    Serial.println(F("CRC mismatch."));
+}
+
+void loop()
+{
+}
@@ -0,0 +1,115 @@
+/************************************************************
+MG2639_HTTP_Client.ino
+MG2639 Cellular Shield library - HTTP Client Example
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This example demonstrates how to use the HTTP client in the
+SparkFun MG2639 Cellular Shield library to GET a page and
+stream the body to the Serial Monitor.
+
+The response is parsed as it arrives, so it can be much
+larger than the Arduino's RAM. Chunked responses are
+decoded, and the TCP link is re-used for the next request
+to the same server (keep-alive).
+
+Functions shown in this example include:
+  cellHTTP.get(host, path) - Send a GET request.
+  cellHTTP.responseStatus() - Read the status and headers.
+  cellHTTP.contentLength() - Size of the body, if known.
+  cellHTTP.readBody(callback) - Stream the body to a function.
+  cellHTTP.keepAlive() - Check if the link can be re-used.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun 
+employee) at the local, and you've found our code helpful, 
+please buy us a round!
+
+Distributed as-is; no warranty is given.
+************************************************************/
+// The SparkFun MG2639 Cellular Shield uses SoftwareSerial
+// to communicate with the MG2639 module. Include that
+// library first:
+#include <SoftwareSerial.h>
+// Include the MG2639 Cellular Shield library
+#include <SFE_MG2639_CellShield.h>
+
+const char server[] = "example.com";
+
+void setup() 
+{
+  Serial.begin(9600);
+  
+  // Call cell.begin() to turn the module on and verify
+  // communication.
+  int beginStatus = cell.begin();
+  if (beginStatus <= 0)
+  {
+    Serial.println(F("Unable to communicate with shield. Looping"));
+    while(1)
+      ;
+  }
+  
+  // gprs.open() enables GPRS. The HTTP client needs an open
+  // GPRS connection.
+  int openStatus = gprs.open();
+  if (openStatus <= 0)
+  {
+    Serial.println(F("Unable to open GPRS. Looping"));
+    while (1)
+      ;
+  }
+  Serial.println(F("GPRS open!"));
+  Serial.println(F("Send any character to GET the page."));
+}
+
+void loop()
+{
+  if (Serial.available())
+  {
+    while (Serial.available())
+      Serial.read();
+    getPage();
+  }
+}
+
+void getPage()
+{
+  // cellHTTP.get() connects (or re-uses the link from the last
+  // request), then sends the request.
+  if (cellHTTP.get(server, "/") <= 0)
+  {
+    Serial.println(F("Request failed."));
+    return;
+  }
+  
+  // cellHTTP.responseStatus() waits for the response and reads
+  // the headers. It returns the HTTP status code.
+  int status = cellHTTP.responseStatus();
+  Serial.print(F("Status: "));
+  Serial.println(status);
+  if (status <= 0)
+    return;
+  
+  Serial.print(F("Content-Length: "));
+  Serial.println(cellHTTP.contentLength());
+  
+  // cellHTTP.readBody() passes the body to printBody() a few
+  // bytes at a time, as it arrives.
+  long length = cellHTTP.readBody(printBody);
+  Serial.println();
+  Serial.print(length);
+  Serial.println(F(" bytes received."));
+  
+  if (cellHTTP.keepAlive())
+    Serial.println(F("Link kept open for the next request."));
+}
+
+void printBody(const uint8_t * data, unsigned int length)
+{
+  Serial.write(data, length);
+}
@@ -0,0 +1,151 @@
+/************************************************************
+MG2639_IVR_Menu.ino
+MG2639 Cellular Shield library - In-Call DTMF Menu Example
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This example demonstrates how to control an Arduino over a
+voice call, with the keys of the caller's phone. Call the
+shield - it answers, and beeps once for the menu:
+  1 - Hear the alarm state: 1 beep off, 2 beeps on
+  2 - Enter the 4-digit PIN (1234), then:
+        1 - Arm the alarm
+        2 - Disarm it
+The menu goes back a level if nothing is pressed for a
+while, and hangs up after three timeouts in a row.
+
+The menu is a table in PROGMEM, so it costs no RAM. Beeps
+are DTMF tones sent back to the caller.
+
+Note: receiving the caller's keys is unverified. The MG2639
+AT manuals don't document a DTMF detection report, so the
+module may never pass the digits on - see MG2639_Phone.h.
+
+Functions shown in this example include:
+  phone.poll(fn) - Follow the call, and collect the digits
+    the caller presses.
+  phone.sendDTMF(digits) - Send tones to the caller.
+  ivr.start() - Start the menu at node 0.
+  ivr.update() - Move through the menu with each digit.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun 
+employee) at the local, and you've found our code helpful, 
+please buy us a round!
+
+Distributed as-is; no warranty is given.
+************************************************************/
+// The SparkFun MG2639 Cellular Shield uses SoftwareSerial
+// to communicate with the MG2639 module. Include that
+// library first:
+#include <SoftwareSerial.h>
+// Include the MG2639 Cellular Shield library
+#include <SFE_MG2639_CellShield.h>
+
+// Node numbers - their place in the table below.
+enum {MENU, STATE, PIN, ARM_MENU, ARM, DISARM, BAD_PIN};
+
+const ivr_node menu[] PROGMEM = {
+  // keys, next,               length, expire, timeout (ms)
+  {"12",   {STATE, PIN},       0,      MENU,   10000}, // MENU
+  {"",     {MENU},             0,      0,      0},     // STATE
+  {"",     {ARM_MENU, BAD_PIN}, 4,     MENU,   10000}, // PIN
+  {"12",   {ARM, DISARM},      0,      MENU,   10000}, // ARM_MENU
+  {"",     {STATE},            0,      0,      0},     // ARM
+  {"",     {STATE},            0,      0,      0},     // DISARM
+  {"",     {MENU},             0,      0,      0}      // BAD_PIN
+};
+
+MG2639_IVR ivr(menu, 7, playPrompt, checkPin);
+
+bool alarmOn = false;
+bool answerCall = false;
+
+void setup() 
+{
+  Serial.begin(9600);
+  
+  // Call cell.begin() to turn the module on and verify
+  // communication.
+  int beginStatus = cell.begin();
+  if (beginStatus <= 0)
+  {
+    Serial.println(F("Unable to communicate with shield. Looping"));
+    while(1)
+      ;
+  }
+  // Delay a bit. If phone was off, it takes a couple seconds
+  // to set up SIM.
+  delay(2000);
+  
+  phone.enableCallerID();
+  Serial.println(F("Call me!"));
+}
+
+void loop() 
+{
+  // poll() follows the call and collects DTMF digits.
+  phone.poll(onCallEvent);
+  
+  if (answerCall)
+  {
+    answerCall = false;
+    if (phone.answer() > 0)
+      ivr.start();
+  }
+  
+  // Walk the menu with the digits pressed.
+  if ((ivr.getNode() != IVR_END) && (ivr.update() == IVR_END))
+    phone.hangUp();
+}
+
+void onCallEvent(call_event event, const char * number, unsigned long latency)
+{
+  if (event == CALL_EVENT_INCOMING)
+  {
+    Serial.print(F("Call from "));
+    Serial.println(number);
+    answerCall = true;
+  }
+  else if (event == CALL_EVENT_ENDED)
+  {
+    Serial.println(F("Call ended"));
+    ivr.stop();
+  }
+}
+
+// playPrompt() is called as each node is entered.
+void playPrompt(uint8_t node)
+{
+  Serial.print(F("Node "));
+  Serial.println(node);
+  switch (node)
+  {
+  case MENU:
+  case ARM_MENU:
+    phone.sendDTMF("1");
+    break;
+  case STATE:
+    phone.sendDTMF(alarmOn ? "11" : "1");
+    break;
+  case ARM:
+    alarmOn = true;
+    break;
+  case DISARM:
+    alarmOn = false;
+    break;
+  case BAD_PIN:
+    phone.sendDTMF("000");
+    break;
+  }
+}
+
+// checkPin() is called with the digits the PIN node collects.
+bool checkPin(uint8_t node, const char * code)
+{
+  return strcmp(code, "1234") == 0;
+}
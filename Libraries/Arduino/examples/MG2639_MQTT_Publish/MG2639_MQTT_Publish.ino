@@ -0,0 +1,141 @@
+/************************************************************
+MG2639_MQTT_Publish.ino
+MG2639 Cellular Shield library - MQTT Example
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This example demonstrates how to use the MQTT client to
+publish sensor readings to a broker over a single, long-
+lived TCP link, and receive commands on a subscribed topic.
+
+Every 10 seconds the value of A0 is published at QoS 1, and
+the time the broker took to acknowledge it is printed. Send
+a message to the "cellshield/cmd" topic (e.g. with
+mosquitto_pub) and it'll be printed to the Serial Monitor.
+
+Functions shown in this example include:
+  mqtt.connect(broker, port, clientId) - Connect to a broker.
+  mqtt.subscribe(topic) - Subscribe to a topic.
+  mqtt.publish(topic, payload, qos) - Publish a message.
+  mqtt.loop() - Receive messages and keep the link alive.
+  mqtt.getLatency() - Time the last PUBACK took to arrive.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun 
+employee) at the local, and you've found our code helpful, 
+please buy us a round!
+
+Distributed as-is; no warranty is given.
+************************************************************/
+// The SparkFun MG2639 Cellular Shield uses SoftwareSerial
+// to communicate with the MG2639 module. Include that
+// library first:
+#include <SoftwareSerial.h>
+// Include the MG2639 Cellular Shield library
+#include <SFE_MG2639_CellShield.h>
+
+// MQTT broker and port. Replace these with your own.
+const char broker[] = "test.mosquitto.org";
+const unsigned int port = 1883;
+// Client ID. Should be unique on the broker.
+const char clientId[] = "cellshield";
+
+const unsigned long publishRate = 10000; // Publish every 10s
+unsigned long lastPublish = 0;
+
+void setup() 
+{
+  Serial.begin(9600);
+  
+  // Call cell.begin() to turn the module on and verify
+  // communication.
+  int beginStatus = cell.begin();
+  if (beginStatus <= 0)
+  {
+    Serial.println(F("Unable to communicate with shield. Looping"));
+    while(1)
+      ;
+  }
+  
+  // gprs.open() enables GPRS.
+  int openStatus = gprs.open();
+  if (openStatus <= 0)
+  {
+    Serial.println(F("Unable to open GPRS. Looping"));
+    while (1)
+      ;
+  }
+  
+  // Messages on subscribed topics are passed to
+  // messageReceived().
+  mqtt.setCallback(messageReceived);
+  connectBroker();
+}
+
+void loop()
+{
+  // mqtt.loop() reads incoming messages and sends keep-alive
+  // pings. Call it often. It returns false if the link is
+  // lost.
+  if (!mqtt.loop())
+  {
+    Serial.println(F("Connection lost. Reconnecting..."));
+    delay(5000);
+    connectBroker();
+    return;
+  }
+  
+  if (millis() - lastPublish >= publishRate)
+  {
+    char payload[8];
+    sprintf(payload, "%d", analogRead(A0));
+    
+    // Publish at QoS 1. publish() waits for the broker's
+    // PUBACK before it returns.
+    if (mqtt.publish("cellshield/a0", payload, 1) > 0)
+    {
+      Serial.print(F("Published "));
+      Serial.print(payload);
+      Serial.print(F(", PUBACK in "));
+      Serial.print(mqtt.getLatency());
+      Serial.print(F(" ms. Bytes sent/received: "));
+      Serial.print(mqtt.getBytesSent());
+      Serial.print('/');
+      Serial.println(mqtt.getBytesReceived());
+    }
+    else
+    {
+      Serial.println(F("Publish failed."));
+    }
+    lastPublish = millis();
+  }
+}
+
+void connectBroker()
+{
+  Serial.print(F("Connecting to "));
+  Serial.println(broker);
+  if (mqtt.connect(broker, port, clientId) > 0)
+  {
+    Serial.println(F("Connected!"));
+    mqtt.subscribe("cellshield/cmd");
+  }
+  else
+  {
+    Serial.print(F("Connect failed, state "));
+    Serial.println(mqtt.state());
+  }
+}
+
+void messageReceived(const char * topic, const uint8_t * payload, unsigned int length)
+{
+  Serial.print(F("Message on "));
+  Serial.print(topic);
+  Serial.print(F(": "));
+  Serial.write(payload, length);
+  Serial.println();
+}
@@ -0,0 +1,133 @@
+/************************************************************
+MG2639_PDU_SMS.ino
+MG2639 Cellular Shield library - PDU-Mode SMS Example
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This example demonstrates how to send and read SMS in PDU
+mode. The library packs the message itself, so every
+character of the GSM alphabet - including '@' - can be
+sent, and binary payloads fit too. Accented letters in the
+GSM alphabet (é, ñ, ü, ¿...) stay 7-bit; text with any
+other character (í, Chinese...) is sent as UCS2
+automatically.
+
+Send a text to the shield: it prints the message, then
+replies with the message's length as text (in Spanish -
+the í makes it go as UCS2), followed by a 4-byte binary message
+holding millis().
+
+Functions shown in this example include:
+  pdu.send(number, text) - Send UTF-8 text, as 7-bit or
+    UCS2.
+  pdu.send(number, data, length) - Send 8-bit binary.
+  pdu.read(index) - Read and decode a message.
+  pdu.getSender(), pdu.getDate(dest), pdu.getData(),
+    pdu.getLength(), pdu.getDCS() - Read the decoded
+    message.
+  pdu.getText(dest, size) - Get 7-bit or UCS2 text as UTF-8.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun 
+employee) at the local, and you've found our code helpful, 
+please buy us a round!
+
+Distributed as-is; no warranty is given.
+************************************************************/
+// The SparkFun MG2639 Cellular Shield uses SoftwareSerial
+// to communicate with the MG2639 module. Include that
+// library first:
+#include <SoftwareSerial.h>
+// Include the MG2639 Cellular Shield library
+#include <SFE_MG2639_CellShield.h>
+
+// The PDU codec keeps a 161-byte receive buffer.
+MG2639_PDU pdu;
+
+void setup() 
+{
+  Serial.begin(9600);
+  
+  // Call cell.begin() to turn the module on and verify
+  // communication.
+  int beginStatus = cell.begin();
+  if (beginStatus <= 0)
+  {
+    Serial.println(F("Unable to communicate with shield. Looping"));
+    while(1)
+      ;
+  }
+  // Delay a bit. If phone was off, it takes a couple seconds
+  // to set up SIM.
+  delay(2000);
+  
+  // pdu.read() and pdu.send() set this themselves, but
+  // sms.available() needs it first.
+  sms.setMode(SMS_PDU_MODE);
+  
+  Serial.println(F("Send me a text message!"));
+}
+
+void loop() 
+{
+  int msgIndex = sms.available(REC_UNREAD);
+  if (msgIndex <= 0)
+  {
+    delay(1000);
+    return;
+  }
+  
+  int length = pdu.read(msgIndex);
+  if (length < 0)
+  {
+    Serial.print(F("Couldn't decode message "));
+    Serial.println(msgIndex);
+    sms.deleteMessage(msgIndex);
+    return;
+  }
+  
+  char date[21];
+  pdu.getDate(date);
+  Serial.print(F("From "));
+  Serial.print(pdu.getSender());
+  Serial.print(F(" at "));
+  Serial.println(date);
+  if (pdu.getDCS() != PDU_DCS_8BIT)
+  {
+    // 7-bit or UCS2 text, as UTF-8. Set the Serial Monitor
+    // to show UTF-8 to see accents and Chinese characters.
+    char text[211];
+    pdu.getText(text, sizeof(text));
+    Serial.println(text);
+  }
+  else
+  {
+    // Binary data - print it as hex.
+    for (int i = 0; i < length; i++)
+    {
+      Serial.print(pdu.getData()[i], HEX);
+      Serial.print(' ');
+    }
+    Serial.println();
+  }
+  
+  // Reply with the length, then millis() as binary. Copy the
+  // sender first - the next read() would overwrite it.
+  char sender[MAX_PHONE_NUMBER_SIZE];
+  strcpy(sender, pdu.getSender());
+  char reply[40];
+  sprintf(reply, "Recibí %d bytes @ %lu", length, millis());
+  pdu.send(sender, reply);
+  
+  unsigned long now = millis();
+  uint8_t data[4];
+  for (int i = 0; i < 4; i++)
+    data[i] = now >> (24 - i * 8);
+  pdu.send(sender, data, 4);
+  
+  sms.deleteMessage(msgIndex);
+}
@@ -71,26 +71,45 @@ void setup()
       ;
   }
   
-  // Then call gprs.open() to establish a GPRS connection.
-  // gprs.open() can take upwards of 30 seconds to connect,
-  // so be patient.
-  while( gprs.open() <= 0)
-  {
-    delay(2000);
-  }
-  
-  // Get our assigned IP address and print it:
-  myIP = gprs.localIP();
-  Serial.print(F("My IP address is: "));
-  Serial.println(myIP);
-  
-  Serial.println(F("Press any key to post to Phant!"));
+  // Then call gprsSession.begin() to start establishing a
+  // GPRS connection. Opening GPRS can take upwards of 30
+  // seconds, so the session manager does it in the
+  // background - retrying with a backoff if it fails - while
+  // gprsSession.update() is called in loop().
+  gprsSession.begin();
+  Serial.println(F("Connecting to GPRS..."));
 }
 
 void loop()
 {
-  // If data has been sent over a TCP link:
-  if (gprs.available())
+  // gprsSession.update() runs the GPRS connection in the
+  // background. It returns the current session state.
+  static bool wasReady = false;
+  gprsSession.update();
+  // isReady() also goes false during each link check, so
+  // look at the state to see when the connection opens.
+  bool ready = (gprsSession.state() == SESSION_READY);
+  if (ready && !wasReady)
+  {
+    // Print how long it took to connect, and how many tries
+    Serial.print(F("GPRS open after "));
+    Serial.print(gprsSession.getConnectTime());
+    Serial.print(F(" ms and "));
+    Serial.print(gprsSession.getTotalRetries());
+    Serial.println(F(" retries."));
+    
+    // Get our assigned IP address and print it:
+    myIP = gprs.localIP();
+    Serial.print(F("My IP address is: "));
+    Serial.println(myIP);
+    
+    Serial.println(F("Press any key to post to Phant!"));
+  }
+  wasReady = ready;
+  
+  // If data has been sent over a TCP link (don't read while
+  // the session manager is still waiting for the module):
+  if (gprsSession.isReady() && gprs.available())
   {  // Print it to the serial monitor:
     Serial.write(gprs.read());
   }
@@ -107,19 +126,17 @@ void loop()
 
 void postToPhant()
 {
-  // Open GPRS. It's OK to call this if GPRS is already
-  // open, it'll just return super-quickly.
-  byte status = gprs.open();
-  if (status <= 0)
+  // Make sure GPRS is open. isReady() doesn't block, so if
+  // the connection is down we just skip this post.
+  if (!gprsSession.isReady())
   {
-    Serial.print(F("Couldn't open GPRS"));
+    Serial.println(F("GPRS isn't open yet"));
     return;
   }
-  Serial.println(F("GPRS open!"));
   
   // Connect to the Phant server (data.sparkfun.com) on
   // port 80.
-  status = gprs.connect(server, 80);
+  int status = gprs.connect(server, 80);
   if (status <= 0)
   {
     Serial.println(F("Error connecting."));
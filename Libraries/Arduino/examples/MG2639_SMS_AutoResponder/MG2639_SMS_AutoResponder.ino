@@ -178,6 +178,17 @@ void loop()
     }
     
   }
+  
+  // Messages that weren't pin reports stay in memory. Once a
+  // minute, sms.checkStorage() makes sure there's room for
+  // more - deleting read messages or, if that's not enough,
+  // storing new ones in the module's memory instead.
+  static unsigned long lastStorageCheck = 0;
+  if (millis() - lastStorageCheck > 60000)
+  {
+    sms.checkStorage();
+    lastStorageCheck = millis();
+  }
   delay(1000);
 }
 
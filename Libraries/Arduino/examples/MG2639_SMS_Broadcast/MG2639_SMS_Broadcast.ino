@@ -0,0 +1,122 @@
+/************************************************************
+MG2639_SMS_Broadcast.ino
+MG2639 Cellular Shield library - SMS Broadcast Example
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This example demonstrates how to send one alert to a list
+of numbers. The message is stored on the SIM once, then the
+stored copy is sent to each number - the text only crosses
+the serial line once.
+
+When pin 2 is pulled low, the alert goes out to everyone
+in onCall[]. Any numbers that failed are retried every
+30 seconds.
+
+Functions shown in this example include:
+  broadcast.send(text, numbers, count) - Store and send.
+  broadcast.retry() - Resend to numbers that failed.
+  broadcast.getResult(i) - Result for number i.
+  broadcast.getFanoutTime() - Time spent sending.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun 
+employee) at the local, and you've found our code helpful, 
+please buy us a round!
+
+Distributed as-is; no warranty is given.
+************************************************************/
+// The SparkFun MG2639 Cellular Shield uses SoftwareSerial
+// to communicate with the MG2639 module. Include that
+// library first:
+#include <SoftwareSerial.h>
+// Include the MG2639 Cellular Shield library
+#include <SFE_MG2639_CellShield.h>
+
+// Numbers to alert. Change these to your own.
+const char * onCall[] = {"13035551234", "13035555678", "13035559012"};
+const uint8_t ON_CALL_COUNT = 3;
+
+const int ALARM_PIN = 2;
+const unsigned long RETRY_INTERVAL = 30000;
+
+MG2639_Broadcast broadcast;
+unsigned long lastRetry = 0;
+
+void setup() 
+{
+  Serial.begin(9600);
+  pinMode(ALARM_PIN, INPUT_PULLUP);
+  
+  // Call cell.begin() to turn the module on and verify
+  // communication.
+  int beginStatus = cell.begin();
+  if (beginStatus <= 0)
+  {
+    Serial.println(F("Unable to communicate with shield. Looping"));
+    while(1)
+      ;
+  }
+  // Delay a bit. If phone was off, it takes a couple seconds
+  // to set up SIM.
+  delay(2000);
+  
+  Serial.println(F("Pull pin 2 low to send the alert."));
+}
+
+void loop() 
+{
+  if (digitalRead(ALARM_PIN) == LOW)
+  {
+    int sent = broadcast.send("Alarm on pin 2!", onCall, ON_CALL_COUNT);
+    if (sent < 0)
+    {
+      Serial.print(F("Couldn't store the message: "));
+      Serial.println(sent);
+    }
+    else
+    {
+      printResults();
+    }
+    lastRetry = millis();
+    // Wait for the pin to be released
+    while (digitalRead(ALARM_PIN) == LOW)
+      ;
+  }
+  
+  if ((broadcast.getFailed() > 0) && (millis() - lastRetry > RETRY_INTERVAL))
+  {
+    Serial.println(F("Retrying..."));
+    broadcast.retry();
+    printResults();
+    lastRetry = millis();
+  }
+}
+
+// printResults() prints the result and time of each send.
+void printResults()
+{
+  for (int i = 0; i < ON_CALL_COUNT; i++)
+  {
+    Serial.print(onCall[i]);
+    if (broadcast.getResult(i) > 0)
+      Serial.print(F(": sent in "));
+    else
+      Serial.print(F(": failed after "));
+    Serial.print(broadcast.getSendTime(i));
+    Serial.println(F(" ms"));
+  }
+  Serial.print(F("Stored in "));
+  Serial.print(broadcast.getStoreTime());
+  Serial.print(F(" ms, sent to "));
+  Serial.print(broadcast.getSent());
+  Serial.print(F(" of "));
+  Serial.print(ON_CALL_COUNT);
+  Serial.print(F(" in "));
+  Serial.print(broadcast.getFanoutTime());
+  Serial.println(F(" ms"));
+}
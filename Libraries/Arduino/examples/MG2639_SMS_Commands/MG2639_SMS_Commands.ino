@@ -0,0 +1,167 @@
+/************************************************************
+MG2639_SMS_Commands.ino
+MG2639 Cellular Shield library - SMS Command Example
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This example demonstrates how to control an Arduino with
+text messages. Commands are kept in a table in flash, and
+each message is looked up in it with a binary search - no
+strstr() for every command.
+
+Text the shield one of these (case doesn't matter):
+  status - Anyone can ask for the status.
+  led on / led off - Turn the LED on pin 13 on or off.
+  led blink <times> - Blink the LED.
+  pump on <seconds> - Run the pump on pin 7.
+  pump off - Stop the pump.
+Only numbers in owners[] can run the LED and pump commands.
+
+Functions shown in this example include:
+  router.setAllowed(numbers, count) - Set who's allowed.
+  router.dispatch(sender, text) - Run a message's command.
+  router.verify() - Check the table is in order.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun 
+employee) at the local, and you've found our code helpful, 
+please buy us a round!
+
+Distributed as-is; no warranty is given.
+************************************************************/
+// The SparkFun MG2639 Cellular Shield uses SoftwareSerial
+// to communicate with the MG2639 module. Include that
+// library first:
+#include <SoftwareSerial.h>
+// Include the MG2639 Cellular Shield library
+#include <SFE_MG2639_CellShield.h>
+
+const int LED_PIN = 13;
+const int PUMP_PIN = 7;
+
+// Numbers allowed to run commands. Change these to your own.
+const char * owners[] = {"13035551234"};
+
+// The command table. Keep it sorted, with lowercase keywords.
+const router_command commands[] PROGMEM = {
+  {"led blink", ledBlink, 0},
+  {"led off",   ledOff,   0},
+  {"led on",    ledOn,    0},
+  {"pump off",  pumpOff,  0},
+  {"pump on",   pumpOn,   0},
+  {"status",    status,   ROUTER_PUBLIC}
+};
+MG2639_Router router(commands, sizeof(commands) / sizeof(commands[0]));
+
+unsigned long pumpStop = 0;
+
+void setup() 
+{
+  Serial.begin(9600);
+  pinMode(LED_PIN, OUTPUT);
+  pinMode(PUMP_PIN, OUTPUT);
+  
+  if (router.verify() >= 0)
+  {
+    Serial.println(F("Command table is out of order. Looping"));
+    while(1)
+      ;
+  }
+  router.setAllowed(owners, 1);
+  
+  // Call cell.begin() to turn the module on and verify
+  // communication.
+  int beginStatus = cell.begin();
+  if (beginStatus <= 0)
+  {
+    Serial.println(F("Unable to communicate with shield. Looping"));
+    while(1)
+      ;
+  }
+  // Delay a bit. If phone was off, it takes a couple seconds
+  // to set up SIM.
+  delay(2000);
+  
+  sms.setMode(SMS_TEXT_MODE);
+  Serial.println(F("Text me a command!"));
+}
+
+void loop() 
+{
+  // Read the first unread message, if there is one.
+  int msgIndex = sms.available(REC_UNREAD);
+  if ((msgIndex > 0) && (sms.read(msgIndex) > 0))
+  {
+    Serial.print(sms.getSender());
+    Serial.print(F(": "));
+    Serial.println(sms.getMessage());
+    
+    int8_t result = router.dispatch(sms.getSender(), sms.getMessage());
+    if (result == 0)
+      Serial.println(F("Unknown command."));
+    else if (result < 0)
+      Serial.println(F("Sender isn't allowed to do that."));
+    
+    sms.deleteMessage(msgIndex);
+  }
+  
+  if ((pumpStop != 0) && (millis() > pumpStop))
+  {
+    digitalWrite(PUMP_PIN, LOW);
+    pumpStop = 0;
+  }
+  
+  delay(1000);
+}
+
+void ledOn(const char * sender, uint8_t argc, char ** argv)
+{
+  digitalWrite(LED_PIN, HIGH);
+}
+
+void ledOff(const char * sender, uint8_t argc, char ** argv)
+{
+  digitalWrite(LED_PIN, LOW);
+}
+
+// "led blink 5" - argv[0] is "5"
+void ledBlink(const char * sender, uint8_t argc, char ** argv)
+{
+  int times = (argc > 0) ? atoi(argv[0]) : 3;
+  for (int i = 0; i < times; i++)
+  {
+    digitalWrite(LED_PIN, HIGH);
+    delay(250);
+    digitalWrite(LED_PIN, LOW);
+    delay(250);
+  }
+}
+
+// "pump on 30" runs the pump for 30 seconds (10 by default)
+void pumpOn(const char * sender, uint8_t argc, char ** argv)
+{
+  unsigned long seconds = (argc > 0) ? atol(argv[0]) : 10;
+  digitalWrite(PUMP_PIN, HIGH);
+  pumpStop = millis() + seconds * 1000;
+}
+
+void pumpOff(const char * sender, uint8_t argc, char ** argv)
+{
+  digitalWrite(PUMP_PIN, LOW);
+  pumpStop = 0;
+}
+
+// "status" texts the LED and pump state back to the sender
+void status(const char * sender, uint8_t argc, char ** argv)
+{
+  sms.start(sender);
+  sms.print(F("LED "));
+  sms.print(digitalRead(LED_PIN) ? F("on") : F("off"));
+  sms.print(F(", pump "));
+  sms.print(digitalRead(PUMP_PIN) ? F("on") : F("off"));
+  sms.send();
+}
@@ -0,0 +1,138 @@
+/************************************************************
+MG2639_SMS_Delivery.ino
+MG2639 Cellular Shield library - SMS Delivery Report Example
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This example demonstrates how to find out whether a text
+message reached the phone it was sent to. The network sends
+back a status report for each message, which is matched to
+the message it belongs to.
+
+Type a phone number into the Serial Monitor (e.g.
++13035551234) to send it an alarm. When its report comes
+back, the result is printed, along with how long the message
+took to be delivered.
+
+Functions shown in this example include:
+  sms.setReports(enable) - Ask the network for a status
+    report on each message sent.
+  sms.getReference() - Get the reference of the last message
+    sent.
+  delivery.track(reference) - Wait for a message's report.
+  delivery.poll(fn) - Read reports, passing the result of
+    each message to fn.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun 
+employee) at the local, and you've found our code helpful, 
+please buy us a round!
+
+Distributed as-is; no warranty is given.
+************************************************************/
+// The SparkFun MG2639 Cellular Shield uses SoftwareSerial
+// to communicate with the MG2639 module. Include that
+// library first:
+#include <SoftwareSerial.h>
+// Include the MG2639 Cellular Shield library
+#include <SFE_MG2639_CellShield.h>
+
+// Keeps the reference of each message until its report
+// comes back.
+MG2639_Delivery delivery;
+
+// Phone number typed into the Serial Monitor
+char number[MAX_PHONE_NUMBER_SIZE];
+uint8_t numberLength = 0;
+
+void setup() 
+{
+  Serial.begin(9600);
+  
+  // Call cell.begin() to turn the module on and verify
+  // communication.
+  int beginStatus = cell.begin();
+  if (beginStatus <= 0)
+  {
+    Serial.println(F("Unable to communicate with shield. Looping"));
+    while(1)
+      ;
+  }
+  // Delay a bit. If phone was off, it takes a couple seconds
+  // to set up SIM.
+  delay(2000);
+  
+  sms.setMode(SMS_TEXT_MODE);
+  // Ask for a status report on every message from now on.
+  if (sms.setReports(true) <= 0)
+    Serial.println(F("Couldn't turn on status reports."));
+  // Give up on a report after 10 minutes.
+  delivery.setTimeout(600000);
+  
+  Serial.println(F("Type a phone number to send an alarm to."));
+}
+
+void loop() 
+{
+  // Reports arrive whenever the network sends them, so read
+  // them before sending anything else.
+  delivery.poll(printReport);
+  
+  while (Serial.available())
+  {
+    char c = Serial.read();
+    if ((c == '\r') || (c == '\n'))
+    {
+      if (numberLength > 0)
+        sendAlarm();
+      numberLength = 0;
+    }
+    else if (numberLength < MAX_PHONE_NUMBER_SIZE - 1)
+    {
+      number[numberLength++] = c;
+      number[numberLength] = '\0';
+    }
+  }
+}
+
+void sendAlarm()
+{
+  sms.start(number);
+  sms.print(F("Freezer alarm! Temperature above -10C."));
+  if (sms.send() > 0)
+  {
+    // Start waiting for this message's report.
+    delivery.track(sms.getReference(), printReport);
+    Serial.print(F("Sent to "));
+    Serial.print(number);
+    Serial.print(F(", reference "));
+    Serial.println(sms.getReference());
+  }
+  else
+  {
+    Serial.println(F("Couldn't send."));
+  }
+}
+
+// printReport() is called once for each message tracked,
+// with how it went and how long it took.
+void printReport(uint8_t reference, delivery_status status, unsigned long latency)
+{
+  Serial.print(F("Message "));
+  Serial.print(reference);
+  if (status == DELIVERY_DELIVERED)
+    Serial.print(F(" delivered in "));
+  else if (status == DELIVERY_FAILED)
+    Serial.print(F(" failed after "));
+  else
+    Serial.print(F(" had no report after "));
+  Serial.print(latency / 1000);
+  Serial.println(F(" s"));
+  Serial.print(F("Waiting for "));
+  Serial.print(delivery.getPending());
+  Serial.println(F(" more."));
+}
@@ -0,0 +1,97 @@
+/************************************************************
+MG2639_SMS_Direct.ino
+MG2639 Cellular Shield library - Direct SMS Receive Example
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This example demonstrates how to receive text messages
+without storing them on the SIM. The module passes each
+message straight to the Arduino as it arrives, so there's
+no read or delete to do afterwards - and nothing is worn
+out on the SIM.
+
+Send the shield a text. It's printed as it arrives, along
+with how long it took to reach printPart() after
+sms.pollDirect() was called.
+
+Functions shown in this example include:
+  sms.setDirect(enable) - Route new messages to the UART.
+  sms.pollDirect(fn) - Read a routed message, passing each
+    part of it to fn.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun 
+employee) at the local, and you've found our code helpful, 
+please buy us a round!
+
+Distributed as-is; no warranty is given.
+************************************************************/
+// The SparkFun MG2639 Cellular Shield uses SoftwareSerial
+// to communicate with the MG2639 module. Include that
+// library first:
+#include <SoftwareSerial.h>
+// Include the MG2639 Cellular Shield library
+#include <SFE_MG2639_CellShield.h>
+
+// Time pollDirect() was called, to measure how long a
+// message takes to reach printPart().
+unsigned long pollStart;
+
+void setup() 
+{
+  Serial.begin(9600);
+  
+  // Call cell.begin() to turn the module on and verify
+  // communication.
+  int beginStatus = cell.begin();
+  if (beginStatus <= 0)
+  {
+    Serial.println(F("Unable to communicate with shield. Looping"));
+    while(1)
+      ;
+  }
+  // Delay a bit. If phone was off, it takes a couple seconds
+  // to set up SIM.
+  delay(2000);
+  
+  // Direct delivery works in text mode.
+  sms.setMode(SMS_TEXT_MODE);
+  // Route new messages to the UART. If your network expects
+  // each message to be acknowledged, use setDirect(true, true).
+  if (sms.setDirect(true) <= 0)
+    Serial.println(F("Couldn't set direct delivery."));
+  
+  Serial.println(F("Send me a text message!"));
+}
+
+void loop() 
+{
+  // Nothing stores a direct message, so check for one often.
+  pollStart = millis();
+  if (sms.pollDirect(printPart) > 0)
+    Serial.println();
+}
+
+// printPart() is called with the sender, then the date,
+// then the body, a piece at a time.
+void printPart(sms_field field, const char * data, uint8_t length)
+{
+  if (field == SMS_FIELD_SENDER)
+  {
+    Serial.print(F("Reached printPart() in "));
+    Serial.print(millis() - pollStart);
+    Serial.println(F(" ms"));
+    Serial.print(F("From: "));
+  }
+  else if (field == SMS_FIELD_DATE)
+  {
+    Serial.print(F("Date: "));
+  }
+  Serial.write((const uint8_t *) data, length);
+  if (field != SMS_FIELD_BODY)
+    Serial.println();
+}
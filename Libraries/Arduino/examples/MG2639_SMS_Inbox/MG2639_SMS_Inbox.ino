@@ -0,0 +1,137 @@
+/************************************************************
+MG2639_SMS_Inbox.ino
+MG2639 Cellular Shield library - SMS Inbox Example
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This example demonstrates how to drain the SIM's inbox in a
+single pass. One AT+CMGL lists every message - the bodies
+are printed as they arrive, and a small table of senders,
+dates, lengths and hashes is kept. Messages are then
+deleted one by one.
+
+Functions shown in this example include:
+  inbox.refresh(status, fn) - List messages, streaming the
+    bodies to fn.
+  inbox.next() - Step through the table.
+  inbox.getSender(slot), inbox.getDate(slot, dest),
+    inbox.getLength(slot), inbox.getHash(slot) - Read the
+    table.
+  inbox.getRefreshTime() - Time the last refresh took.
+  inbox.remove(slot) - Delete a message.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun 
+employee) at the local, and you've found our code helpful, 
+please buy us a round!
+
+Distributed as-is; no warranty is given.
+************************************************************/
+// The SparkFun MG2639 Cellular Shield uses SoftwareSerial
+// to communicate with the MG2639 module. Include that
+// library first:
+#include <SoftwareSerial.h>
+// Include the MG2639 Cellular Shield library
+#include <SFE_MG2639_CellShield.h>
+
+// The inbox table takes 25 bytes of RAM per message.
+MG2639_Inbox inbox;
+
+int8_t lastSlot = -2; // Slot of the body being printed
+
+void setup() 
+{
+  Serial.begin(9600);
+  
+  // Call cell.begin() to turn the module on and verify
+  // communication.
+  int beginStatus = cell.begin();
+  if (beginStatus <= 0)
+  {
+    Serial.println(F("Unable to communicate with shield. Looping"));
+    while(1)
+      ;
+  }
+  // Delay a bit. If phone was off, it takes a couple seconds
+  // to set up SIM.
+  delay(2000);
+  
+  // The inbox is read in text mode.
+  sms.setMode(SMS_TEXT_MODE);
+  
+  Serial.println(F("Press any key to read the inbox."));
+}
+
+void loop() 
+{
+  if (!Serial.available())
+    return;
+  while (Serial.available())
+    Serial.read();
+  
+  // List every message, printing the bodies as they arrive.
+  lastSlot = -2;
+  int listed = inbox.refresh(REC_ALL, printBody);
+  Serial.println();
+  if (listed < 0)
+  {
+    Serial.println(F("Error listing messages."));
+    return;
+  }
+  Serial.print(listed);
+  Serial.print(F(" messages listed in "));
+  Serial.print(inbox.getRefreshTime());
+  Serial.println(F(" ms."));
+  
+  // Step through the table. Slots past the one just
+  // removed move down by one, so delete from the top.
+  char date[18];
+  int slot;
+  while ((slot = inbox.next()) >= 0)
+  {
+    inbox.getDate(slot, date);
+    Serial.print(F("From "));
+    Serial.print(inbox.getSender(slot));
+    Serial.print(F(" at "));
+    Serial.print(date);
+    Serial.print(F(", "));
+    Serial.print(inbox.getLength(slot));
+    Serial.print(F(" characters, hash "));
+    Serial.println(inbox.getHash(slot), HEX);
+  }
+  
+  Serial.println(F("Delete all of them? (y/n)"));
+  while (!Serial.available())
+    ;
+  if (Serial.read() == 'y')
+  {
+    while (inbox.count() > 0)
+    {
+      if (inbox.remove(inbox.count() - 1) <= 0)
+      {
+        Serial.println(F("Error deleting."));
+        break;
+      }
+    }
+  }
+  Serial.println(F("Press any key to read the inbox again."));
+}
+
+// printBody() is called by refresh() with each piece of a
+// message body. A new slot means a new message.
+void printBody(int8_t slot, const char * data, uint8_t length)
+{
+  if (slot != lastSlot)
+  {
+    Serial.println();
+    Serial.print(F("Message "));
+    Serial.print(slot);
+    Serial.print(F(": "));
+    lastSlot = slot;
+  }
+  Serial.write((const uint8_t *) data, length);
+}
@@ -0,0 +1,125 @@
+/************************************************************
+MG2639_SMS_Multipart.ino
+MG2639 Cellular Shield library - Long SMS Example
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This example demonstrates how to send and receive messages
+longer than 160 characters. Long messages are split into
+parts on the way out, and put back together on the way in -
+the callback only sees a message once every part of it has
+arrived.
+
+Send the shield a text of any length. It prints it, then
+texts you back a long status report.
+
+Functions shown in this example include:
+  multipart.send(number, text) - Send a long message.
+  multipart.poll(fn) - Check the SIM, and pass complete
+    messages to fn, a part at a time.
+  multipart.getPending() - Messages still missing parts.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun 
+employee) at the local, and you've found our code helpful, 
+please buy us a round!
+
+Distributed as-is; no warranty is given.
+************************************************************/
+// The SparkFun MG2639 Cellular Shield uses SoftwareSerial
+// to communicate with the MG2639 module. Include that
+// library first:
+#include <SoftwareSerial.h>
+// Include the MG2639 Cellular Shield library
+#include <SFE_MG2639_CellShield.h>
+
+MG2639_PDU pdu;
+MG2639_Multipart multipart(pdu);
+
+// Number to reply to, filled in when a message arrives.
+char replyTo[MAX_PHONE_NUMBER_SIZE] = "";
+
+void setup() 
+{
+  Serial.begin(9600);
+  
+  // Call cell.begin() to turn the module on and verify
+  // communication.
+  int beginStatus = cell.begin();
+  if (beginStatus <= 0)
+  {
+    Serial.println(F("Unable to communicate with shield. Looping"));
+    while(1)
+      ;
+  }
+  // Delay a bit. If phone was off, it takes a couple seconds
+  // to set up SIM.
+  delay(2000);
+  
+  Serial.println(F("Send me a text message - as long as you like!"));
+}
+
+void loop() 
+{
+  // Check the SIM every few seconds. Complete messages are
+  // passed to printMessage(), then deleted.
+  multipart.poll(printMessage);
+  
+  if (replyTo[0] != '\0')
+  {
+    sendReport(replyTo);
+    replyTo[0] = '\0';
+  }
+  
+  delay(5000);
+}
+
+// printMessage() is called with each part of a complete
+// message, in order.
+void printMessage(const char * sender, const uint8_t * data, uint8_t length, uint8_t part, uint8_t total)
+{
+  if (part == 1)
+  {
+    Serial.print(F("From "));
+    Serial.print(sender);
+    Serial.print(F(", "));
+    Serial.print(total);
+    Serial.println(F(" part(s):"));
+    strcpy(replyTo, sender);
+  }
+  if (pdu.getDCS() == PDU_DCS_8BIT)
+  {
+    Serial.write(data, length);
+  }
+  else
+  {
+    // 7-bit or UCS2 text, as UTF-8. Set the Serial Monitor
+    // to show UTF-8 to see accents.
+    char text[211];
+    pdu.getText(text, sizeof(text));
+    Serial.print(text);
+  }
+  if (part == total)
+    Serial.println();
+}
+
+// sendReport() sends a message too long for one SMS.
+void sendReport(const char * number)
+{
+  char report[300];
+  sprintf(report, "Status report. Uptime: %lu s. "
+          "Analog inputs: A0=%d A1=%d A2=%d A3=%d. "
+          "Incomplete messages waiting for parts: %d. "
+          "This report is longer than 160 characters, so "
+          "it's sent in parts and reassembled by your phone.",
+          millis() / 1000, analogRead(A0), analogRead(A1),
+          analogRead(A2), analogRead(A3), multipart.getPending());
+  int parts = multipart.send(number, report);
+  Serial.print(F("Sent report in "));
+  Serial.print(parts);
+  Serial.println(F(" part(s)."));
+}
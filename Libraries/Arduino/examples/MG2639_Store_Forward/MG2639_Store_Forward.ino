@@ -0,0 +1,142 @@
+/************************************************************
+MG2639_Store_Forward.ino
+MG2639 Cellular Shield library - Store-and-Forward Example
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This example demonstrates how to use MG2639_Queue to keep
+sensor readings in EEPROM while the cellular link is down,
+then upload them in a batch when it comes back.
+
+Readings are taken every SAMPLE_INTERVAL milliseconds and
+pushed onto the queue - that's only a few EEPROM writes, so
+it's cheap. Every DRAIN_INTERVAL, if GPRS is up, the queue is
+drained over a single TCP connection. Readings survive a
+reset or power failure.
+
+Functions shown in this example include:
+  queue.begin() - Rebuild the queue from EEPROM.
+  queue.push(record, length) - Add a reading to the queue.
+  queue.drain(domain, port, max, send) - Upload up to max
+    readings over one TCP connection.
+  queue.depth(), queue.capacity(), queue.getDropped(),
+    queue.getDrainRate() - Queue statistics.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun 
+employee) at the local, and you've found our code helpful, 
+please buy us a round!
+
+Distributed as-is; no warranty is given.
+************************************************************/
+// The SparkFun MG2639 Cellular Shield uses SoftwareSerial
+// to communicate with the MG2639 module. Include that
+// library first:
+#include <SoftwareSerial.h>
+// Include the MG2639 Cellular Shield library
+#include <SFE_MG2639_CellShield.h>
+
+// Destination server and port. Replace these with your own
+// TCP listener.
+const char server[] = "example.com";
+const unsigned int serverPort = 5000;
+
+// Keep the queue in the first 512 bytes of EEPROM. Each
+// slot is QUEUE_SLOT_SIZE (21) bytes, so that's 24 readings.
+MG2639_EEPROMStorage storage(0, 512);
+MG2639_Queue queue(storage);
+
+#define SAMPLE_INTERVAL 10000 // Take a reading every 10 s
+#define DRAIN_INTERVAL 60000 // Try to upload every minute
+#define DRAIN_BATCH 10 // Maximum readings per upload
+unsigned long lastSample = 0;
+unsigned long lastDrain = 0;
+
+void setup() 
+{
+  Serial.begin(9600);
+  
+  // queue.begin() scans EEPROM and returns the number of
+  // readings left over from before the last reset.
+  unsigned int waiting = queue.begin();
+  Serial.print(waiting);
+  Serial.print(F(" of "));
+  Serial.print(queue.capacity());
+  Serial.println(F(" readings waiting."));
+  
+  // Call cell.begin() to turn the module on and verify
+  // communication.
+  int beginStatus = cell.begin();
+  if (beginStatus <= 0)
+  {
+    Serial.println(F("Unable to communicate with shield. Looping"));
+    while(1)
+      ;
+  }
+  
+  // gprsSession opens GPRS in the background, so readings
+  // are still taken while the link is down.
+  gprsSession.begin();
+}
+
+void loop()
+{
+  gprsSession.update();
+  
+  if (millis() - lastSample >= SAMPLE_INTERVAL)
+  {
+    takeReading();
+    lastSample = millis();
+  }
+  
+  if (gprsSession.isReady() && (queue.depth() > 0) &&
+      (millis() - lastDrain >= DRAIN_INTERVAL))
+  {
+    int sent = queue.drain(server, serverPort, DRAIN_BATCH, sendReading);
+    Serial.print(F("Sent: "));
+    Serial.print(sent);
+    Serial.print(F(", left: "));
+    Serial.print(queue.depth());
+    Serial.print(F(", records/s: "));
+    Serial.println(queue.getDrainRate());
+    lastDrain = millis();
+  }
+}
+
+void takeReading()
+{
+  // Each record is a timestamp and two analog readings.
+  uint8_t record[8];
+  unsigned long now = millis();
+  unsigned int a0 = analogRead(A0);
+  unsigned int a1 = analogRead(A1);
+  memcpy(record, &now, 4);
+  memcpy(record + 4, &a0, 2);
+  memcpy(record + 6, &a1, 2);
+  
+  if (!queue.push(record, sizeof(record)))
+  {
+    Serial.print(F("Queue full, dropped: "));
+    Serial.println(queue.getDropped());
+  }
+}
+
+// sendReading is called by queue.drain() for each record. It
+// formats the record as a line of text: "time,a0,a1".
+bool sendReading(Print & out, const uint8_t * record, uint8_t length)
+{
+  unsigned long time;
+  unsigned int a0, a1;
+  memcpy(&time, record, 4);
+  memcpy(&a0, record + 4, 2);
+  memcpy(&a1, record + 6, 2);
+  
+  char line[30];
+  sprintf(line, "%lu,%u,%u\n", time, a0, a1);
+  // gprs.print() returns the number of bytes sent
+  return out.print(line) == strlen(line);
+}
@@ -0,0 +1,105 @@
+/************************************************************
+MG2639_TCP_Server.ino
+MG2639 Cellular Shield library - TCP Server Example
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This example demonstrates how to use the TCP server
+functionality of the SparkFun MG2639 Cellular Shield library.
+Instead of polling a server for new configuration every few
+minutes, the shield listens on a port and a server can push
+data to it whenever it needs to.
+
+Connect to the IP address printed in the Serial Monitor
+(e.g. with "nc <ip> 1174") and type something. It will be
+echoed to the Serial Monitor, and the shield will reply.
+Note that many carriers block incoming connections - you may
+need a SIM with a public IP address for this to work.
+
+Functions shown in this example include:
+  tcpServer.begin(port) - Start listening on a port.
+  tcpServer.accept() - Check for a new connection.
+  tcpServer.available() - Check for data from a connection.
+  tcpServer.read() - Read data from a connection.
+  tcpServer.print() - Send data to the active connection.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun 
+employee) at the local, and you've found our code helpful, 
+please buy us a round!
+
+Distributed as-is; no warranty is given.
+************************************************************/
+// The SparkFun MG2639 Cellular Shield uses SoftwareSerial
+// to communicate with the MG2639 module. Include that
+// library first:
+#include <SoftwareSerial.h>
+// Include the MG2639 Cellular Shield library
+#include <SFE_MG2639_CellShield.h>
+
+const unsigned int listenPort = 1174;
+
+void setup() 
+{
+  Serial.begin(9600);
+  
+  // Call cell.begin() to turn the module on and verify
+  // communication.
+  int beginStatus = cell.begin();
+  if (beginStatus <= 0)
+  {
+    Serial.println(F("Unable to communicate with shield. Looping"));
+    while(1)
+      ;
+  }
+  
+  // A GPRS connection must be open before we can listen.
+  int openStatus = gprs.open();
+  if (openStatus <= 0)
+  {
+    Serial.println(F("Unable to open GPRS. Looping"));
+    while (1)
+      ;
+  }
+  
+  // tcpServer.begin(port) starts listening on a port.
+  if (tcpServer.begin(listenPort) <= 0)
+  {
+    Serial.println(F("Unable to listen. Looping"));
+    while (1)
+      ;
+  }
+  // Close connections that have been quiet for 2 minutes.
+  tcpServer.setIdleTimeout(120000);
+  
+  Serial.print(F("Listening on "));
+  Serial.print(gprs.localIP());
+  Serial.print(':');
+  Serial.println(listenPort);
+}
+
+void loop()
+{
+  // tcpServer.accept() returns the channel of a new
+  // connection, or -1 if there isn't one.
+  int newChannel = tcpServer.accept();
+  if (newChannel >= 0)
+  {
+    Serial.print(F("New connection on channel "));
+    Serial.println(newChannel);
+  }
+  
+  // Read any data sent to us:
+  if (tcpServer.available())
+  {
+    // Reply to whichever connection sent the data.
+    tcpServer.setActiveChannel(tcpServer.channel());
+    while (tcpServer.available())
+      Serial.write(tcpServer.read());
+    tcpServer.print("OK\r\n");
+  }
+}
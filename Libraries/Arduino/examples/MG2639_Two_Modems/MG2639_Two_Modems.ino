@@ -0,0 +1,138 @@
+/************************************************************
+MG2639_Two_Modems.ino
+MG2639 Cellular Shield library - Two Modem Example
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This example demonstrates how to drive two MG2639 modules
+from one Arduino Mega - e.g. with SIMs on two carriers, so
+alarms still go out when one network is down. Messages take
+turns between the modules, sharing out each SIM's sending
+limits. If one module can't send, the other tries.
+
+The first module is the shield, used through the global
+cell, sms and phone. The second is wired to the Mega's
+Serial1 (pins 18 and 19), with its PWRKEY on pin 8 and RING
+on A1. Hardware serial ports can receive at the same time,
+where two SoftwareSerials can't.
+
+The other classes are bound the same way, to an SMS, GPRS
+or phone object - e.g. MG2639_PDU backupPDU(backupSMS), or
+MG2639_MQTT backupMQTT(backupGPRS). Left out, they use the
+global sms, gprs or phone.
+
+Type a phone number into the Serial Monitor (e.g.
++13035551234) to send it 4 alarms.
+
+Functions shown in this example include:
+  MG2639_Cell(port, onOffPin) - Declare another module.
+  MG2639_SMS(modem) - SMS functions bound to a module.
+  MG2639_Phone(modem, ringPin) - Phone functions bound to a
+    module.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Mega
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun 
+employee) at the local, and you've found our code helpful, 
+please buy us a round!
+
+Distributed as-is; no warranty is given.
+************************************************************/
+// The SparkFun MG2639 Cellular Shield uses SoftwareSerial
+// to communicate with the MG2639 module. Include that
+// library first:
+#include <SoftwareSerial.h>
+// Include the MG2639 Cellular Shield library
+#include <SFE_MG2639_CellShield.h>
+
+// The second module, and its SMS and phone functions
+MG2639_Cell backup(Serial1, 8);
+MG2639_SMS backupSMS(backup);
+MG2639_Phone backupPhone(backup, A1);
+
+// Both SMS objects, to take turns between them
+MG2639_SMS * modems[2] = {&sms, &backupSMS};
+uint8_t nextModem = 0;
+
+// Phone number typed into the Serial Monitor
+char number[MAX_PHONE_NUMBER_SIZE];
+uint8_t numberLength = 0;
+
+void setup() 
+{
+  Serial.begin(9600);
+  
+  // Each module is turned on and checked by its own begin().
+  if (cell.begin() <= 0)
+    Serial.println(F("Shield module isn't responding."));
+  if (backup.begin() <= 0)
+    Serial.println(F("Second module isn't responding."));
+  // Delay a bit. If phone was off, it takes a couple seconds
+  // to set up SIM.
+  delay(2000);
+  
+  sms.setMode(SMS_TEXT_MODE);
+  backupSMS.setMode(SMS_TEXT_MODE);
+  
+  Serial.println(F("Type a phone number to send alarms to."));
+}
+
+void loop() 
+{
+  // Either module can take a call.
+  if (phone.available() || backupPhone.available())
+    Serial.println(F("Ring ring!"));
+  
+  while (Serial.available())
+  {
+    char c = Serial.read();
+    if ((c == '\r') || (c == '\n'))
+    {
+      if (numberLength > 0)
+      {
+        for (int i = 1; i <= 4; i++)
+          sendAlarm(i);
+      }
+      numberLength = 0;
+    }
+    else if (numberLength < MAX_PHONE_NUMBER_SIZE - 1)
+    {
+      number[numberLength++] = c;
+      number[numberLength] = '\0';
+    }
+  }
+}
+
+// sendAlarm() sends through the next module in turn, and
+// through the other one if that fails.
+void sendAlarm(int alarm)
+{
+  for (int tries = 0; tries < 2; tries++)
+  {
+    MG2639_SMS * modem = modems[nextModem];
+    uint8_t used = nextModem;
+    nextModem = (nextModem + 1) % 2;
+    
+    unsigned long start = millis();
+    modem->start(number);
+    modem->print(F("Freezer alarm #"));
+    modem->print(alarm);
+    if (modem->send() > 0)
+    {
+      Serial.print(F("Alarm "));
+      Serial.print(alarm);
+      Serial.print(F(" sent by module "));
+      Serial.print(used + 1);
+      Serial.print(F(" in "));
+      Serial.print(millis() - start);
+      Serial.println(F(" ms"));
+      return;
+    }
+    Serial.print(F("Module "));
+    Serial.print(used + 1);
+    Serial.println(F(" couldn't send. Trying the other."));
+  }
+}
@@ -0,0 +1,122 @@
+/************************************************************
+MG2639_UDP_Telemetry.ino
+MG2639 Cellular Shield library - UDP Telemetry Example
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This example demonstrates how to use the UDP functionality
+of the SparkFun MG2639 Cellular Shield library to send small
+sensor readings to a server without the cost of opening and
+closing a TCP connection for every reading.
+
+Each reading is a single datagram: 28 bytes of IP/UDP header
+plus the payload. Replies from the server (if any) are
+printed to the Serial Monitor.
+
+Functions shown in this example include:
+  udp.beginPacket(server, port) - Set up (once) a UDP link
+    to the server and start a new packet.
+  udp.print() - Add data to the packet.
+  udp.endPacket() - Send the packet.
+  udp.parsePacket() - Check for a packet from the server.
+  udp.read() - Read the received packet.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun 
+employee) at the local, and you've found our code helpful, 
+please buy us a round!
+
+Distributed as-is; no warranty is given.
+************************************************************/
+// The SparkFun MG2639 Cellular Shield uses SoftwareSerial
+// to communicate with the MG2639 module. Include that
+// library first:
+#include <SoftwareSerial.h>
+// Include the MG2639 Cellular Shield library
+#include <SFE_MG2639_CellShield.h>
+
+// Destination server and port. Replace these with your own
+// UDP listener.
+IPAddress serverIP(204, 144, 132, 37);
+const unsigned int serverPort = 5000;
+
+// Send a reading every SEND_INTERVAL milliseconds
+#define SEND_INTERVAL 60000
+unsigned long lastSend = 0;
+
+void setup() 
+{
+  Serial.begin(9600);
+  
+  // Call cell.begin() to turn the module on and verify
+  // communication.
+  int beginStatus = cell.begin();
+  if (beginStatus <= 0)
+  {
+    Serial.println(F("Unable to communicate with shield. Looping"));
+    while(1)
+      ;
+  }
+  
+  // gprs.open() enables GPRS. UDP links require an open
+  // GPRS connection, just like TCP.
+  int openStatus = gprs.open();
+  if (openStatus <= 0)
+  {
+    Serial.println(F("Unable to open GPRS. Looping"));
+    while (1)
+      ;
+  }
+  Serial.println(F("GPRS open!"));
+}
+
+void loop()
+{
+  if ((lastSend == 0) || (millis() - lastSend >= SEND_INTERVAL))
+  {
+    sendReading();
+    lastSend = millis();
+  }
+  
+  // udp.parsePacket() checks for a packet from the server.
+  // It returns the size of the packet, or 0 if there isn't
+  // one.
+  int packetSize = udp.parsePacket();
+  if (packetSize > 0)
+  {
+    Serial.print(F("Received "));
+    Serial.print(packetSize);
+    Serial.println(F(" bytes:"));
+    while (udp.available())
+      Serial.write(udp.read());
+    Serial.println();
+  }
+}
+
+void sendReading()
+{
+  // udp.beginPacket() only sets up the UDP link the first
+  // time (or if the destination changes). After that it
+  // just starts a new packet.
+  if (udp.beginPacket(serverIP, serverPort) <= 0)
+  {
+    Serial.println(F("Unable to set up UDP link."));
+    return;
+  }
+  
+  // Add the readings to the packet. Up to UDP_TX_BUFFER_SIZE
+  // bytes can be added to a single packet.
+  udp.print(analogRead(A0));
+  udp.print(',');
+  udp.print(analogRead(A1));
+  
+  // udp.endPacket() sends the packet.
+  if (udp.endPacket() > 0)
+    Serial.println(F("Reading sent."));
+  else
+    Serial.println(F("Send failed."));
+}
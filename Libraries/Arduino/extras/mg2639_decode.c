@@ -0,0 +1,139 @@
+/******************************************************************************
+mg2639_decode.c
+MG2639 Cellular Shield Library - Server-Side Upload Decoder
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+Decodes uploads made with MG2639_Compressor and/or MG2639_Delta (see
+src/util/MG2639_Compress.h) back into one line of comma-separated fields per
+record. Reads the upload from stdin, writes CSV to stdout.
+
+Build:	cc -O2 -o mg2639_decode mg2639_decode.c
+Usage:	mg2639_decode [-r] <fields> < upload.bin > records.csv
+	<fields> - Number of fields per record (the count given to addRecord()).
+	-r - The upload is raw delta records, not run through MG2639_Compressor.
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define MIN_MATCH 3 // COMPRESS_MIN_MATCH
+#define MAX_FIELDS 8 // DELTA_MAX_FIELDS
+
+// Delta decoder state
+static int fieldCount;
+static int32_t previous[MAX_FIELDS];
+static int field;
+static uint32_t varint;
+static int varintShift;
+
+// LZSS history. Offsets are at most 255, so 256 bytes is enough.
+static uint8_t history[256];
+static uint8_t historyPos;
+
+static void resetStream(void)
+{
+	memset(previous, 0, sizeof(previous));
+	field = 0;
+	varint = 0;
+	varintShift = 0;
+}
+
+// Feed one decompressed byte to the delta decoder.
+static void deltaByte(uint8_t b)
+{
+	varint |= (uint32_t) (b & 0x7F) << varintShift;
+	varintShift += 7;
+	if (b & 0x80)
+		return;
+	
+	int32_t delta = (int32_t) (varint >> 1) ^ -(int32_t) (varint & 1);
+	previous[field] += delta;
+	printf("%ld%c", (long) previous[field], (field == fieldCount - 1) ? '\n' : ',');
+	field = (field + 1) % fieldCount;
+	varint = 0;
+	varintShift = 0;
+}
+
+static void lzssByte(uint8_t b)
+{
+	history[historyPos++] = b;
+	deltaByte(b);
+}
+
+// Decompress MG2639_Compressor output. A match with offset 0 ends a stream;
+// the delta decoder starts over with the next one.
+static void decompress(FILE * in)
+{
+	int flags, c;
+	
+	while ((flags = getc(in)) != EOF)
+	{
+		for (int i = 0; i < 8; i++)
+		{
+			if (flags & (1 << i))
+			{
+				if ((c = getc(in)) == EOF)
+					return;
+				lzssByte(c);
+			}
+			else
+			{
+				int offset = getc(in);
+				int length = getc(in);
+				if ((offset == EOF) || (length == EOF))
+					return;
+				if (offset == 0)
+				{
+					resetStream();
+					break; // The rest of this group is unused
+				}
+				for (length += MIN_MATCH; length > 0; length--)
+					lzssByte(history[(uint8_t) (historyPos - offset)]);
+			}
+		}
+	}
+}
+
+int main(int argc, char * argv[])
+{
+	int raw = 0, c;
+	int arg = 1;
+	
+	if ((argc > arg) && (strcmp(argv[arg], "-r") == 0))
+	{
+		raw = 1;
+		arg++;
+	}
+	if (argc <= arg)
+	{
+		fprintf(stderr, "Usage: %s [-r] <fields> < upload.bin\n", argv[0]);
+		return 1;
+	}
+	fieldCount = atoi(argv[arg]);
+	if ((fieldCount < 1) || (fieldCount > MAX_FIELDS))
+	{
+		fprintf(stderr, "fields must be 1-%d\n", MAX_FIELDS);
+		return 1;
+	}
+	
+	resetStream();
+	if (raw)
+	{
+		while ((c = getc(stdin)) != EOF)
+			deltaByte(c);
+	}
+	else
+	{
+		decompress(stdin);
+	}
+	
+	return 0;
+}
@@ -27,13 +27,49 @@ Distributed as-is; no warranty is given.
 unsigned long baudRates[BAUD_COUNT] = {2400, 4800, 9600, 19200, 38400, 
 										57600, 115200};
 	
+// UART of the global cell
+SoftwareSerial cellUART(CELL_SW_TX, CELL_SW_RX);
+	
 /////////////////
 // Constructor //
 /////////////////
-MG2639_Cell::MG2639_Cell():uart0(CELL_SW_TX, CELL_SW_RX)
+MG2639_Cell::MG2639_Cell()
+{
+	uart0 = &cellUART;
+	_softPort = &cellUART;
+	_hardPort = NULL;
+	_onOffPin = CELL_ON_OFF;
+	memset(rxBuffer, '\0', RX_BUFFER_LENGTH); // Clear rxBuffer
+	clearBuffer(); // Clear UART receive buffer
+	_rtsPin = -1;
+	_ctsPin = -1;
+	_overruns = 0;
+}
+
+MG2639_Cell::MG2639_Cell(SoftwareSerial & port, uint8_t onOffPin)
 {
+	uart0 = &port;
+	_softPort = &port;
+	_hardPort = NULL;
+	_onOffPin = onOffPin;
 	memset(rxBuffer, '\0', RX_BUFFER_LENGTH); // Clear rxBuffer
 	clearBuffer(); // Clear UART receive buffer
+	_rtsPin = -1;
+	_ctsPin = -1;
+	_overruns = 0;
+}
+
+MG2639_Cell::MG2639_Cell(HardwareSerial & port, uint8_t onOffPin)
+{
+	uart0 = &port;
+	_softPort = NULL;
+	_hardPort = &port;
+	_onOffPin = onOffPin;
+	memset(rxBuffer, '\0', RX_BUFFER_LENGTH); // Clear rxBuffer
+	clearBuffer(); // Clear UART receive buffer
+	_rtsPin = -1;
+	_ctsPin = -1;
+	_overruns = 0;
 }
 
 //////////////////////////////
@@ -98,6 +134,14 @@ uint8_t MG2639_Cell::begin(unsigned long baud)
 		delay(COMMAND_RESPONSE_TIME);
 	}
 	
+	// If RTS/CTS are wired up, turn on flow control in the module too.
+	if ((_rtsPin >= 0) || (_ctsPin >= 0))
+	{
+		if (setFlowControl() <= 0)
+			return 0;
+	}
+	_overruns = 0;
+	
 	return 1;
 }
 
@@ -105,7 +149,19 @@ uint8_t MG2639_Cell::begin()
 {
 	// begin() works just like begin([baud]), but we'll call
 	// TARGET_BAUD_RATE defined in the h file.
-	begin(TARGET_BAUD_RATE);
+	return begin(TARGET_BAUD_RATE);
+}
+
+void MG2639_Cell::enableFlowControl(int8_t rtsPin, int8_t ctsPin)
+{
+	_rtsPin = rtsPin;
+	_ctsPin = ctsPin;
+}
+
+unsigned long MG2639_Cell::getOverrunCount()
+{
+	updateFlowControl(); // Catch any overflow that hasn't been counted yet
+	return _overruns;
 }
 
 //////////////////////
@@ -115,15 +171,25 @@ uint8_t MG2639_Cell::begin()
 void MG2639_Cell::initializePins()
 {
 	// Set ON/OFF and RESET pins as OUTPUTs:
-	pinMode(CELL_ON_OFF, OUTPUT);	// Set CELL_ON_OFF as an OUTPUT
-	digitalWrite(CELL_ON_OFF, LOW);
+	pinMode(_onOffPin, OUTPUT);	// Set the ON/OFF pin as an OUTPUT
+	digitalWrite(_onOffPin, LOW);
+	
+	if (_rtsPin >= 0)
+	{
+		pinMode(_rtsPin, OUTPUT);
+		// RTS is active-low. Keep it de-asserted - dataAvailable() asserts
+		// it while the library is polling for data.
+		digitalWrite(_rtsPin, HIGH);
+	}
+	if (_ctsPin >= 0)
+		pinMode(_ctsPin, INPUT);
 }
 
 void MG2639_Cell::powerPulse()
 {
-	digitalWrite(CELL_ON_OFF, HIGH);	// Writing high will initiate
-	delay(POWER_PULSE_DURATION);		// Delay 2 to 5 seconds to turn on/off
-	digitalWrite(CELL_ON_OFF, LOW);		// Writing low will end the pulse
+	digitalWrite(_onOffPin, HIGH);	// Writing high will initiate
+	delay(POWER_PULSE_DURATION);	// Delay 2 to 5 seconds to turn on/off
+	digitalWrite(_onOffPin, LOW);	// Writing low will end the pulse
 }
 
 ///////////////////////////////
@@ -147,6 +213,19 @@ int MG2639_Cell::setEcho(uint8_t on)
 	return iRetVal;
 }
 
+int MG2639_Cell::setFlowControl()
+{
+	char ifcCmd[10];
+	
+	// Send "AT+IFC=<TE->TA>,<TA->TE>". 2 enables RTS/CTS, 0 disables.
+	memset(ifcCmd, 0, 10);
+	sprintf(ifcCmd, "%s=%d,%d", FLOW_CONTROL, (_rtsPin >= 0) ? 2 : 0, 
+	        (_ctsPin >= 0) ? 2 : 0);
+	sendATCommand((const char *)ifcCmd);
+	
+	return readWaitForResponses(RESPONSE_OK, RESPONSE_ERROR, COMMAND_RESPONSE_TIME);
+}
+
 ///////////////////////
 // Baud Rate Control //
 ///////////////////////
@@ -445,6 +524,63 @@ int MG2639_Cell::readUntil(char * dest, char end, int maxChars,
 	return ERROR_TIMEOUT;
 }
 
+long MG2639_Cell::readNumber(char end, unsigned int timeout)
+{
+	unsigned long timeIn = millis();
+	long value = 0;
+	char c = 0;
+	
+	while (timeIn + timeout > millis())
+	{
+		if (dataAvailable())
+		{
+			c = uartRead();
+			if (c == end)
+				return value;
+			else if ((c >= '0') && (c <= '9'))
+				value = (value * 10) + (c - '0');
+		}
+	}
+	
+	return ERROR_TIMEOUT;
+}
+
+int MG2639_Cell::readChar(unsigned int timeout)
+{
+	unsigned long timeIn = millis();
+	
+	while (timeIn + timeout > millis())
+	{
+		if (dataAvailable())
+			return uartRead();
+	}
+	
+	return ERROR_TIMEOUT;
+}
+
+int MG2639_Cell::readQuoted(char * dest, int size, unsigned int timeout)
+{
+	int length = 0;
+	int c;
+	
+	while ((c = readChar(timeout)) != '\"')
+	{
+		if (c < 0)
+			return ERROR_TIMEOUT;
+	}
+	while ((c = readChar(timeout)) != '\"')
+	{
+		if (c < 0)
+			return ERROR_TIMEOUT;
+		if (length < size - 1)
+			dest[length] = c;
+		length++;
+	}
+	dest[(length < size - 1) ? length : size - 1] = '\0';
+	
+	return length;
+}
+
 int MG2639_Cell::readWaitForResponse(const char *goodRsp, unsigned int timeout)
 {
 	unsigned long timeIn = millis();	// Timestamp coming into function
@@ -521,14 +657,25 @@ void MG2639_Cell::initializeUART(long baud)
 {
 	// End any previously started UART 
 	// (maybe it was begin()'s at a different baud rate)
-	uart0.end();
-	// Start our UART at the requested baud rate
-	uart0.begin(baud);
+	// Then start our UART at the requested baud rate
+	if (_softPort != NULL)
+	{
+		_softPort->end();
+		_softPort->begin(baud);
+	}
+	else
+	{
+		_hardPort->end();
+		_hardPort->begin(baud);
+	}
 }
 
 void MG2639_Cell::printString(const char * str)
 {
-	uart0.print(str); // Abstracting a UART print char array
+	if (_ctsPin < 0)
+		uart0->print(str); // Abstracting a UART print char array
+	else
+		printString(str, strlen(str));
 }
 
 void MG2639_Cell::printString(const char * str, size_t length)
@@ -536,18 +683,27 @@ void MG2639_Cell::printString(const char * str, size_t length)
 	unsigned int i;
 	for (i = 0; i < length; i++)
 	{
-		uart0.write(str[i]);
+		waitForCTS();
+		uart0->write(str[i]);
 	}
 }
 
 void MG2639_Cell::printChar(char c)
 {
-	uart0.print(c); // Abstracting a UART print char
+	waitForCTS();
+	uart0->print(c); // Abstracting a UART print char
 }
 
 unsigned char MG2639_Cell::uartRead()
 {
-	return uart0.read(); // Abstracting UART read
+	unsigned char c = uart0->read(); // Abstracting UART read
+	updateFlowControl();
+	return c;
+}
+
+int MG2639_Cell::uartPeek()
+{
+	return uart0->peek(); // Abstracting UART peek
 }
 
 unsigned int MG2639_Cell::readByteToBuffer()
@@ -571,31 +727,85 @@ void MG2639_Cell::clearBuffer()
 
 char * MG2639_Cell::searchBuffer(const char * test)
 {
-	int bufferLen = strlen((const char *)rxBuffer);
-	// If our buffer isn't full, just do an strstr
-	if (bufferLen < RX_BUFFER_LENGTH)
+	// If our buffer hasn't wrapped yet, the last byte is still a 0 and the
+	// buffer is a regular string. Just do an strstr.
+	if (rxBuffer[RX_BUFFER_LENGTH - 1] == '\0')
 		return strstr((const char *)rxBuffer, test);
-	else
-	{	//! TODO
-		// If the buffer is full, we need to search from the end of the 
-		// buffer back to the beginning.
-		int testLen = strlen(test);
-		for (int i=0; i<RX_BUFFER_LENGTH; i++)
+	
+	// If the buffer is full, the oldest character is at bufferHead. Search
+	// from there to the end of the buffer, then wrap back to the beginning.
+	int testLen = strlen(test);
+	for (int i=0; i<=RX_BUFFER_LENGTH - testLen; i++)
+	{
+		int start = (bufferHead + i) % RX_BUFFER_LENGTH;
+		int j;
+		for (j=0; j<testLen; j++)
 		{
-			
+			if (rxBuffer[(start + j) % RX_BUFFER_LENGTH] != test[j])
+				break;
 		}
+		if (j == testLen)
+			return (char *) &rxBuffer[start];
 	}
+	
+	return NULL;
 }
 
 int MG2639_Cell::dataAvailable()
 {
-	return uart0.available();
+	// Only one SoftwareSerial receives at a time - make it this one
+	if ((_softPort != NULL) && !_softPort->isListening())
+		_softPort->listen();
+	updateFlowControl();
+	
+	// RTS is only asserted while we're in here, so the module can't overrun
+	// the buffer while the sketch is busy elsewhere. Let data in until the
+	// buffer reaches RTS_HIGH_WATER, or the module goes quiet.
+	int buffered = uart0->available();
+	if ((_rtsPin >= 0) && (buffered < RTS_HIGH_WATER))
+	{
+		unsigned long lastByte = millis();
+		digitalWrite(_rtsPin, LOW); // Let the module send
+		while ((buffered < RTS_HIGH_WATER) && (millis() - lastByte < RTS_POLL_TIME))
+		{
+			if (uart0->available() != buffered)
+			{
+				buffered = uart0->available();
+				lastByte = millis();
+			}
+		}
+		digitalWrite(_rtsPin, HIGH); // Stop the module from sending
+		updateFlowControl();
+	}
+	
+	return buffered;
+}
+
+void MG2639_Cell::updateFlowControl()
+{
+	// SoftwareSerial sets an overflow flag when a byte arrives with its
+	// buffer full. Reading the flag clears it.
+	if ((_softPort != NULL) && _softPort->overflow())
+		_overruns++;
+}
+
+void MG2639_Cell::waitForCTS()
+{
+	if (_ctsPin < 0)
+		return;
+	
+	// The module holds CTS high while it can't accept more data
+	unsigned long timeIn = millis();
+	while ((digitalRead(_ctsPin) == HIGH) && (timeIn + CTS_TIMEOUT > millis()))
+		;
 }
 
 void MG2639_Cell::clearSerial()
 {
-	while (uart0.available())
-		uart0.read();
+	if ((_softPort != NULL) && !_softPort->isListening())
+		_softPort->listen();
+	while (uart0->available())
+		uart0->read();
 }
 
 MG2639_Cell cell;
\ No newline at end of file
@@ -27,6 +27,22 @@ Distributed as-is; no warranty is given.
 #include "util/MG2639_SMS.h"	// SMS (text messaging) functions (send, read, etc.)
 #include "util/MG2639_GPRS.h" // GPRS functions (TCP connect, send, etc.)
 #include "util/MG2639_Phone.h" // Phone call functions (answer, dial, hangup, etc.)
+#include "util/MG2639_UDP.h" // UDP functions (beginPacket, endPacket, etc.)
+#include "util/MG2639_Server.h" // TCP server functions (listen, accept, etc.)
+#include "util/MG2639_Session.h" // Non-blocking GPRS session manager
+#include "util/MG2639_Queue.h" // Store-and-forward record queue
+#include "util/MG2639_Encoder.h" // Compact binary (CBOR) record encoder
+#include "util/MG2639_Compress.h" // Delta and LZSS upload compression
+#include "util/MG2639_HTTP.h" // HTTP/1.1 client (get, post, etc.)
+#include "util/MG2639_Download.h" // Resumable downloads to storage
+#include "util/MG2639_MQTT.h" // MQTT 3.1.1 client (publish, subscribe, etc.)
+#include "util/MG2639_Inbox.h" // SMS inbox cache (refresh, next, etc.)
+#include "util/MG2639_PDU.h" // PDU-mode SMS codec (send, read, decode, etc.)
+#include "util/MG2639_Multipart.h" // Concatenated SMS (send, add, poll, etc.)
+#include "util/MG2639_Broadcast.h" // SMS broadcast (send, retry, getResult, etc.)
+#include "util/MG2639_Router.h" // SMS command router (dispatch, setAllowed, etc.)
+#include "util/MG2639_Delivery.h" // SMS delivery reports (track, poll, etc.)
+#include "util/MG2639_IVR.h" // In-call DTMF menus (start, update, press, etc.)
 
 ////////////////////////
 // Memory Allocations //
@@ -39,12 +55,32 @@ Distributed as-is; no warranty is given.
 #define CELL_SW_RX	3	// Cellular module UART0 RXI goes to Arduino pin 3
 #define CELL_SW_TX	2	// Cellular module UART0 TXO goes to Arduino pin 2
 #define CELL_ON_OFF	7	// PWRKEY_N on cell module goes to Arduino pin 7
+// These are the pins of the global cell. A second shield (or module) needs
+// its own pins - see the MG2639_Cell constructors.
+// The shield doesn't connect the module's RTS and CTS pins. If you wire them
+// up yourself, pass the Arduino pins to enableFlowControl() before begin().
+
+//////////////////////////////
+// Flow Control Definitions //
+//////////////////////////////
+// When flow control is enabled, RTS is held de-asserted (the module holds
+// its data) except while the library polls the UART. Each poll lets data in
+// until the receive buffer is RTS_HIGH_WATER bytes full, or nothing new has
+// arrived for RTS_POLL_TIME ms. The rest of the 64-byte SoftwareSerial buffer
+// catches what the module sends after RTS is de-asserted.
+#define RTS_HIGH_WATER	48
+#define RTS_POLL_TIME	2
+#define CTS_TIMEOUT		1000 // Max time (ms) to wait for CTS before sending
 
 ////////////////////////////////
 // SoftwareSerial Definitions //
 ////////////////////////////////
 // TARGET_BAUD_RATE sets the desired communication rate between Arduino and
 // MG2639. 9600 is a safe rate -- higher bauds are much less reliable.
+// With RTS/CTS wired up and enableFlowControl() called, begin(115200) can be
+// used - data only flows while the library is polling, so it's slower than
+// the baud rate suggests. For full speed use a HardwareSerial port. Check
+// getOverrunCount() to verify no data is being lost.
 #define TARGET_BAUD_RATE 9600
 
 ////////////////////////////
@@ -75,9 +111,23 @@ public:
 	////////////////////////////////////
 	
 	/// MG2639_Cell() - Constructor
-	/// - Initializes rxBuffer and uart0.
+	/// - Initializes rxBuffer. Talks through a SoftwareSerial on the
+	/// shield's pins (CELL_SW_TX, CELL_SW_RX) and powers on with CELL_ON_OFF,
+	/// as the global cell does.
 	MG2639_Cell();
 	
+	/// MG2639_Cell([port], [onOffPin]) - Constructor for another module
+	/// - Talks to the module through [port], a SoftwareSerial or
+	/// HardwareSerial the sketch declares (not begun), and pulses [onOffPin]
+	/// to turn it on. e.g., on a Mega:
+	///		MG2639_Cell backup(Serial1, 8);
+	///		MG2639_SMS backupSMS(backup);
+	/// Only one SoftwareSerial can receive at a time - switching between
+	/// two throws away what the other had buffered. Give each module its
+	/// own hardware serial port when there's more than one.
+	MG2639_Cell(SoftwareSerial & port, uint8_t onOffPin);
+	MG2639_Cell(HardwareSerial & port, uint8_t onOffPin);
+	
 	/// begin([baud]) - Cell shield initialization at specified baud rate
 	///
 	/// Attempt to initialize the cellular shield at a specific baud rate.
@@ -99,6 +149,23 @@ public:
 	/// Returns: 0 if communication fails, 1 on success.
 	uint8_t begin();
 	
+	/// enableFlowControl([rtsPin], [ctsPin]) - Use hardware flow control
+	/// on the UART. Must be called before begin().
+	/// [rtsPin] is the Arduino pin wired to the module's RTS input, [ctsPin]
+	/// is the pin wired to the module's CTS output. Either can be -1 if it
+	/// isn't connected. begin() will send AT+IFC to turn on flow control in
+	/// the module.
+	/// SoftwareSerial fills its buffer from an interrupt the library can't
+	/// hook, so RTS is only asserted while the library is checking the UART
+	/// (see RTS_POLL_TIME) - the module holds its data the rest of the time.
+	/// Checks for data can take up to RTS_POLL_TIME ms longer.
+	void enableFlowControl(int8_t rtsPin, int8_t ctsPin);
+	
+	/// getOverrunCount() - Returns the number of times the SoftwareSerial
+	/// receive buffer has overflowed (data was lost) since begin(). Hardware
+	/// serial ports don't report it, so they always return 0.
+	unsigned long getOverrunCount();
+	
 	///////////////////////
 	// Baud Rate Control //
 	///////////////////////
@@ -173,10 +240,24 @@ public:
 	friend class MG2639_GPRS;
 	friend class MG2639_SMS;
 	friend class MG2639_Phone;
+	friend class MG2639_UDP;
+	friend class MG2639_Server;
+	friend class MG2639_Session;
+	friend class MG2639_Inbox;
+	friend class MG2639_PDU;
+	friend class MG2639_Multipart;
+	friend class MG2639_Broadcast;
+	friend class MG2639_Delivery;
 
 private:
-	// SoftwareSerial is used to communicate with the shield's UART0.
-	SoftwareSerial uart0;
+	// The module's UART0 - a SoftwareSerial or a hardware serial port. The
+	// one that isn't used is NULL.
+	Stream * uart0;
+	SoftwareSerial * _softPort;
+	HardwareSerial * _hardPort;
+	
+	// PWRKEY_N pin
+	uint8_t _onOffPin;
 	
 	// Characters received on the software serial uart are stored in rxBuffer.
 	// rxBuffer is a circular buffer with no overwrite protection.
@@ -185,6 +266,12 @@ private:
 	unsigned char rxBuffer[RX_BUFFER_LENGTH];
 	unsigned int bufferHead; // Holds position of latest byte placed in buffer.
 	
+	// Flow control pins, -1 if not used.
+	int8_t _rtsPin;
+	int8_t _ctsPin;
+	// Number of SoftwareSerial receive buffer overflows
+	unsigned long _overruns;
+	
 	//////////////////////////////
 	// Initialization Functions //
 	//////////////////////////////
@@ -254,6 +341,33 @@ private:
 	///  - >1 if [end] character was read.
 	int readUntil(char * dest, char end, int maxChars, unsigned int timeout);
 	
+	/// readNumber([end], [timeout]) - Read a decimal number directly from the
+	/// UART. Any non-digit characters before [end] are skipped, so this can
+	/// be used to step through comma-separated fields like "1,5,".
+	/// e.g.: readNumber(',', COMMAND_RESPONSE_TIME); // Reads "12" from "12,"
+	///
+	/// Returns:
+	///  - ERROR_TIMEOUT (-1) if [end] wasn't read within [timeout] ms
+	///  - >=0 the number read on success
+	long readNumber(char end, unsigned int timeout);
+	
+	/// readChar([timeout]) - Read one character directly from the UART,
+	/// waiting up to [timeout] ms for it to arrive.
+	///
+	/// Returns: The character, or ERROR_TIMEOUT (-1) if none arrived.
+	int readChar(unsigned int timeout);
+	
+	/// readQuoted([dest], [size], [timeout]) - Read directly from the UART.
+	/// Skip to the next '"', then copy the quoted string after it into
+	/// [dest], cut to [size] - 1 characters. Unlike readBetween(), the
+	/// string can't overrun [dest]. [timeout] applies to each character.
+	/// e.g.: readQuoted(number, 16, COMMAND_RESPONSE_TIME); // From ,"1303...",
+	///
+	/// Returns:
+	///  - ERROR_TIMEOUT (-1) if a character didn't arrive in time
+	///  - >=0 the length of the string (before it was cut) on success
+	int readQuoted(char * dest, int size, unsigned int timeout);
+	
 	//////////////////////////////////
 	// rxBuffer Searching Functions //
 	//////////////////////////////////
@@ -275,6 +389,11 @@ private:
 	/// Returns: <0 if the module didn't respond. >0 on success.
 	int setEcho(uint8_t on);
 	
+	/// setFlowControl() - Sends AT+IFC to match the module's flow control to
+	/// the pins given to enableFlowControl().
+	/// Returns: <0 if the module didn't respond. >0 on success.
+	int setFlowControl();
+	
 	//////////////////////
 	// UART Abstraction //
 	//////////////////////
@@ -287,12 +406,15 @@ private:
 	void printChar(char c);
 	
 	/// dataAvailable() - Returns number of characters available in
-	/// UART receive buffer.
+	/// UART receive buffer. With RTS in use, lets the module send first.
 	int dataAvailable();
 	
 	/// uartRead() - UART read char abstraction
 	unsigned char uartRead();
 	
+	/// uartPeek() - UART peek char abstraction
+	int uartPeek();
+	
 	/// readByteToBuffer() - Read first byte from UART receive buffer
 	/// and store it in rxBuffer.
 	unsigned int readByteToBuffer();
@@ -300,6 +422,13 @@ private:
 	/// clearSerial() - Empty UART receive buffer
 	void clearSerial();
 	
+	/// updateFlowControl() - Check for receive buffer overruns.
+	void updateFlowControl();
+	
+	/// waitForCTS() - Wait (up to CTS_TIMEOUT) for the module to assert CTS
+	/// before sending. Returns immediately if CTS isn't used.
+	void waitForCTS();
+	
 	//////////////////////
 	// rxBuffer Control //
 	//////////////////////
@@ -308,9 +437,10 @@ private:
 	void clearBuffer();
 	
 	/// searchBuffer([test]) - Search buffer for string [test]
+	/// Once rxBuffer has wrapped around, the search starts at the oldest
+	/// character and wraps back to the beginning of the array.
 	/// Success: Returns pointer to beginning of string
 	/// Fail: returns NULL
-	//! TODO: Fix this function so it searches circularly
 	char * searchBuffer(const char * test);	
 };
 
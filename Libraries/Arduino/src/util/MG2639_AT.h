@@ -47,6 +47,10 @@ const char READ_IMI[] = "+CIMI";	// Read the international mobile identification
 const char GET_IMEI[] = "+GSN"; // Get the current device's IMEI
 const char CHECK_SIM[] = "*TSIMINS?"; // Check SIM card status
 const char CHECK_STATUS[] = "+CLCC";
+const char CALLER_ID[] = "+CLIP";	// Show the caller's number after each RING
+const char SEND_DTMF[] = "+VTS";	// Send DTMF tones during a call
+const char HOLD_CALL[] = "+CHLD";	// Hold, swap or release calls
+const char CHECK_REGISTRATION[] = "+CREG?";	// Check network registration status
 
 ///////////////////////////////
 // Data Compression Commands //
@@ -87,6 +91,7 @@ const char SMS_DELETE[] = "+CMGD";
 const char SMS_LIST[] = "+CMGL";
 const char SMS_SIM_SAVED[] = "+CMSS";
 const char SMS_FULL[] = "+ZSMGS";
+const char SMS_PARAMETERS[] = "+CSMP";
 
 ////////////////////////
 // Phonebook Commands //
@@ -99,6 +104,30 @@ const char OWNERS_NUMBER[] = "+CNUM";
 const char TCP_SETUP[] = "+ZIPSETUP";		// Set up a TCP link
 const char TCP_SEND[] = "+ZIPSEND";		// Send data over a TCP link
 const char TCP_STATUS[] = "+ZPPPSTATUS";	// Check GPRS connection status
+const char TCP_CLOSE[] = "+ZIPCLOSE";		// Close a TCP link
+const char TCP_RECEIVE[] = "+ZIPRECV:";	// Unsolicited TCP data received
+const char TRANSPARENT_SETUP[] = "+ZTRANSFER";	// Set up transparent transfer
+const char RESPONSE_CMD_MODE[] = "cmd mode";	// Printed after "+++" escape
+
+///////////////////////
+// UDP Link Commands //
+///////////////////////
+const char UDP_SETUP[] = "+ZIPSETUPU";	// Set up a UDP link
+const char UDP_SEND[] = "+ZIPSENDU";		// Send data over a UDP link
+const char UDP_STATUS[] = "+ZIPSTATUSU";	// Check UDP link status
+const char UDP_CLOSE[] = "+ZIPCLOSEU";	// Close a UDP link
+const char UDP_RECEIVE[] = "+ZIPRECVU:";	// Unsolicited UDP data received
+
+/////////////////////
+// Server Commands //
+/////////////////////
+const char SERVER_LISTEN[] = "+ZTCPLISTEN";	// Enable/disable port monitoring
+const char SERVER_SEND[] = "+ZTCPSENDP";	// Send data over a passively opened link
+const char SERVER_CLOSE[] = "+ZTCPCLOSEP";	// Close a passively opened link
+const char SERVER_STATUS[] = "+ZTCPSTATUSP";	// Check a passively opened link
+const char SERVER_TIMEOUT[] = "+ZIPTIMEOUT";	// Set connect and send timeouts
+const char SERVER_RECEIVE[] = "+ZTCPRECV";	// Unsolicited data on a passive link
+const char SERVER_INCOMING[] = "INCOMING CONNECT";	// Unsolicited connection accepted
 
 ////////////////////
 // Audio Commands //
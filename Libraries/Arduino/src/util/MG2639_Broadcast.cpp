@@ -0,0 +1,209 @@
+/******************************************************************************
+MG2639_Broadcast.cpp
+MG2639 Cellular Shield Library - SMS Broadcast Source
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines a store-once, send-many SMS
+broadcast. MG2639_Broadcast, a friend class of MG2639_Cell, stores a message
+with AT+CMGW and sends it to each recipient with AT+CMSS.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include "MG2639_Broadcast.h"
+#include "MG2639_AT.h"
+#include <SFE_MG2639_CellShield.h>
+
+MG2639_Broadcast::MG2639_Broadcast(MG2639_SMS & modem)
+{
+	_sms = &modem;
+	memset(_results, 0, sizeof(_results));
+	_numbers = NULL;
+	_count = 0;
+	_index = -1;
+	_storeTime = 0;
+	_fanoutTime = 0;
+}
+
+int MG2639_Broadcast::send(const char * text, const char * const * numbers, uint8_t count)
+{
+	int iRetVal;
+	int sent = 0;
+	unsigned long timeIn;
+	
+	if (count > BROADCAST_MAX_RECIPIENTS)
+		return ERROR_OVERRUN_PREVENT;
+	
+	// Don't leave the last broadcast filling up the SIM
+	if (_index >= 0)
+		clear();
+	
+	memset(_results, 0, sizeof(_results));
+	_numbers = numbers;
+	_count = count;
+	
+	iRetVal = store(text);
+	if (iRetVal < 0)
+		return iRetVal;
+	
+	timeIn = millis();
+	for (uint8_t i = 0; i < _count; i++)
+	{
+		if (sendStored(i) > 0)
+			sent++;
+	}
+	_fanoutTime = millis() - timeIn;
+	
+	return sent;
+}
+
+int MG2639_Broadcast::retry()
+{
+	int sent = 0;
+	unsigned long timeIn = millis();
+	
+	if (_index < 0)
+		return ERROR_FAIL_RESPONSE;
+	
+	for (uint8_t i = 0; i < _count; i++)
+	{
+		if (_results[i].result > 0)
+			continue;
+		if (sendStored(i) > 0)
+			sent++;
+	}
+	_fanoutTime = millis() - timeIn;
+	
+	return sent;
+}
+
+int8_t MG2639_Broadcast::clear()
+{
+	int8_t iRetVal;
+	
+	if (_index < 0)
+		return SUCCESS_OK;
+	
+	iRetVal = _sms->deleteMessage(_index);
+	if (iRetVal > 0)
+		_index = -1;
+	
+	return iRetVal;
+}
+
+uint8_t MG2639_Broadcast::getSent()
+{
+	uint8_t sent = 0;
+	
+	for (uint8_t i = 0; i < _count; i++)
+	{
+		if (_results[i].result > 0)
+			sent++;
+	}
+	return sent;
+}
+
+uint8_t MG2639_Broadcast::getFailed()
+{
+	uint8_t failed = 0;
+	
+	for (uint8_t i = 0; i < _count; i++)
+	{
+		if (_results[i].result < 0)
+			failed++;
+	}
+	return failed;
+}
+
+int MG2639_Broadcast::store(const char * text)
+{
+	int iRetVal;
+	long index;
+	unsigned long timeIn = millis();
+	
+	if (_sms->getMode() != SMS_TEXT_MODE)
+	{
+		iRetVal = _sms->setMode(SMS_TEXT_MODE);
+		if (iRetVal < 0)
+			return iRetVal;
+	}
+	
+	// AT+CMGW, with no number - each AT+CMSS gives one.
+	// Example response:
+	// > Freezer alarm!<CTRL+Z>\r\n
+	// +CMGW: 3\r\n
+	// \r\n
+	// OK
+	_sms->getCell().clearSerial();
+	_sms->getCell().clearBuffer();
+	_sms->getCell().sendATCommand(SMS_WRITE);
+	iRetVal = _sms->getCell().readWaitForResponses(">", RESPONSE_ERROR,
+	                                               COMMAND_RESPONSE_TIME);
+	if (iRetVal < 0)
+		return iRetVal;
+	_sms->getCell().printString(text);
+	_sms->getCell().printChar(CTRL_Z);
+	
+	iRetVal = _sms->getCell().readWaitForResponses("+CMGW: ", RESPONSE_ERROR,
+	                                               SMS_COMMAND_TIMEOUT);
+	if (iRetVal < 0)
+		return iRetVal;
+	index = _sms->getCell().readNumber('\r', COMMAND_RESPONSE_TIME);
+	if (index < 0)
+		return index;
+	_sms->getCell().readWaitForResponse(RESPONSE_OK, COMMAND_RESPONSE_TIME);
+	
+	_index = index;
+	_storeTime = millis() - timeIn;
+	
+	return _index;
+}
+
+int8_t MG2639_Broadcast::sendStored(uint8_t recipient)
+{
+	int iRetVal;
+	char tempCmd[32];
+	long reference;
+	unsigned long timeIn = millis();
+	broadcast_result * result = &_results[recipient];
+	
+	// Max phone number digits is 15, add 2 for quotes, 3 for the index, 6 for
+	// command, 2 for '=' and ','
+	if (strlen(_numbers[recipient]) >= MAX_PHONE_NUMBER_SIZE)
+	{
+		result->result = ERROR_OVERRUN_PREVENT;
+		return result->result;
+	}
+	sprintf(tempCmd, "%s=%d,\"%s\"", SMS_SIM_SAVED, _index, _numbers[recipient]);
+	
+	// Example response:
+	// +CMSS: 12\r\n
+	// \r\n
+	// OK
+	_sms->getCell().clearSerial();
+	_sms->getCell().clearBuffer();
+	_sms->getCell().sendATCommand((const char *)tempCmd);
+	iRetVal = _sms->getCell().readWaitForResponses("+CMSS: ", RESPONSE_ERROR,
+	                                               SMS_COMMAND_TIMEOUT);
+	if (iRetVal > 0)
+	{
+		reference = _sms->getCell().readNumber('\r', COMMAND_RESPONSE_TIME);
+		if (reference >= 0)
+			result->reference = reference;
+		_sms->getCell().readWaitForResponse(RESPONSE_OK, COMMAND_RESPONSE_TIME);
+		iRetVal = SUCCESS_OK;
+	}
+	result->result = iRetVal;
+	result->time = millis() - timeIn;
+	
+	return result->result;
+}
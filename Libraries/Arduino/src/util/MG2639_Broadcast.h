@@ -0,0 +1,144 @@
+/******************************************************************************
+MG2639_Broadcast.h
+MG2639 Cellular Shield Library - SMS Broadcast Header
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines a store-once, send-many SMS
+broadcast. MG2639_Broadcast, a friend class of MG2639_Cell, writes a message
+to the SIM once with AT+CMGW, then sends the stored copy to each recipient
+with AT+CMSS - the body crosses the UART once, however many numbers it goes
+to. The result of each send is kept, and the whole fan-out is timed.
+
+e.g.:	const char * onCall[] = {"+13035551234", "+13035555678"};
+		MG2639_Broadcast broadcast;
+		broadcast.send("Freezer alarm!", onCall, 2);
+		if (broadcast.getFailed() > 0)
+			broadcast.retry();
+
+Text mode is used (sms.setMode(SMS_TEXT_MODE) is called if needed).
+
+Per recipient, for a 160-character message at 9600 baud:
+
+	                 | UART characters | UART time | Prompt wait
+	-----------------+-----------------+-----------+------------
+	sms.start/send   | ~195            | ~0.20 s   | Yes
+	(AT+CMGS)        |                 |           |
+	broadcast (after | ~35             | ~0.04 s   | No
+	one AT+CMGW)     |                 |           |
+
+Both still wait for the network to accept each message, typically 1-4 s,
+which is usually most of the time. getFanoutTime() measures the sends on
+your network.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#ifndef _MG2639_BROADCAST_H_
+#define _MG2639_BROADCAST_H_
+
+#include <Arduino.h>
+#include "MG2639_SMS.h"
+
+// BROADCAST_MAX_RECIPIENTS - Most numbers one broadcast can go to. Each
+// takes 4 bytes of RAM for its result.
+#define BROADCAST_MAX_RECIPIENTS 8
+
+class MG2639_Broadcast
+{
+public:
+	/// MG2639_Broadcast([modem]) - Constructor
+	/// Sets up class variables. Messages go through [modem] - the global sms
+	/// if it's left out.
+	MG2639_Broadcast(MG2639_SMS & modem = sms);
+	
+	/// send([text], [numbers], [count]) - Store [text] on the SIM, and send
+	/// it to each of the [count] [numbers]. The stored copy is kept, so
+	/// retry() can send it again to any that failed. [numbers] must stay
+	/// valid until the next send().
+	///
+	/// Returns: Number of recipients it was sent to, <0 if it couldn't be
+	/// stored (ERROR_OVERRUN_PREVENT if [count] is over
+	/// BROADCAST_MAX_RECIPIENTS).
+	int send(const char * text, const char * const * numbers, uint8_t count);
+	
+	/// retry() - Send the stored message again to each recipient that
+	/// failed.
+	///
+	/// Returns: Number of recipients it was sent to this time, <0 if there's
+	/// no stored message.
+	int retry();
+	
+	/// clear() - Delete the stored message from the SIM.
+	///
+	/// Returns: >0 on success, <0 on fail.
+	int8_t clear();
+	
+	//////////////////////////
+	// Broadcast Statistics //
+	//////////////////////////
+	
+	/// getResult([recipient]) - Returns the result of the last send to
+	/// [recipient] (0 to count - 1): >0 if sent, <0 on fail
+	/// (ERROR_FAIL_RESPONSE if the module or network refused it), 0 if not
+	/// tried yet.
+	inline int8_t getResult(uint8_t recipient) { return _results[recipient].result; };
+	
+	/// getReference([recipient]) - Returns the message reference (TP-MR)
+	/// the network gave the message sent to [recipient].
+	inline uint8_t getReference(uint8_t recipient) { return _results[recipient].reference; };
+	
+	/// getSendTime([recipient]) - Returns the time (ms) the send to
+	/// [recipient] took.
+	inline unsigned int getSendTime(uint8_t recipient) { return _results[recipient].time; };
+	
+	/// getSent() and getFailed() - Return the number of recipients the
+	/// message has been sent to, and the number still failed.
+	uint8_t getSent();
+	uint8_t getFailed();
+	
+	/// getStoreTime() - Returns the time (ms) AT+CMGW took.
+	inline unsigned long getStoreTime() { return _storeTime; };
+	
+	/// getFanoutTime() - Returns the time (ms) the last send() or retry()
+	/// spent sending to its recipients, not counting getStoreTime().
+	inline unsigned long getFanoutTime() { return _fanoutTime; };
+	
+	/// getIndex() - Returns the SIM index of the stored message, or -1 if
+	/// there isn't one.
+	inline int getIndex() { return _index; };
+
+private:
+	MG2639_SMS * _sms;
+	struct broadcast_result {
+		int8_t result;
+		uint8_t reference;
+		unsigned int time;
+	};
+	
+	broadcast_result _results[BROADCAST_MAX_RECIPIENTS];
+	const char * const * _numbers;
+	uint8_t _count;
+	int _index; // SIM index of the stored message, -1 if none
+	unsigned long _storeTime;
+	unsigned long _fanoutTime;
+	
+	/// store([text]) - Write [text] to the SIM with AT+CMGW.
+	/// Returns: The SIM index on success, <0 on fail.
+	int store(const char * text);
+	
+	/// sendStored([recipient]) - Send the stored message to one recipient
+	/// with AT+CMSS, and record the result.
+	/// Returns: >0 on success, <0 on fail.
+	int8_t sendStored(uint8_t recipient);
+};
+
+#endif
@@ -0,0 +1,224 @@
+/******************************************************************************
+MG2639_Compress.cpp
+MG2639 Cellular Shield Library - Upload Compression Source
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines an optional compression
+stage for uploads: MG2639_Delta (per-field delta, zig-zag varints) and
+MG2639_Compressor (fixed-window LZSS).
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include "MG2639_Compress.h"
+#include <SFE_MG2639_CellShield.h>
+
+// A group is a flag byte followed by up to 8 items of at most 2 bytes each
+#define COMPRESS_GROUP_MAX 17
+
+// Longest match that fits in a match's length byte
+#define COMPRESS_MAX_MATCH (255 + COMPRESS_MIN_MATCH)
+
+////////////////////
+// Delta Encoding //
+////////////////////
+
+MG2639_Delta::MG2639_Delta(Print & out)
+{
+	_out = &out;
+	reset();
+}
+
+void MG2639_Delta::reset()
+{
+	memset(_previous, 0, sizeof(_previous));
+}
+
+size_t MG2639_Delta::addRecord(const long * fields, uint8_t count)
+{
+	size_t written = 0;
+	
+	if (count > DELTA_MAX_FIELDS)
+		count = DELTA_MAX_FIELDS;
+	
+	for (int i = 0; i < count; i++)
+	{
+		int32_t value = fields[i];
+		int32_t delta = value - _previous[i];
+		// Zig-zag: 0, -1, 1, -2, 2... become 0, 1, 2, 3, 4... so small
+		// negative differences are small varints too.
+		uint32_t zigzag = ((uint32_t) delta << 1) ^ (uint32_t) (delta >> 31);
+		written += writeVarint(zigzag);
+		_previous[i] = value;
+	}
+	
+	return written;
+}
+
+size_t MG2639_Delta::writeVarint(uint32_t value)
+{
+	size_t written = 0;
+	
+	while (value >= 0x80)
+	{
+		written += _out->write((uint8_t) (value | 0x80));
+		value >>= 7;
+	}
+	written += _out->write((uint8_t) value);
+	
+	return written;
+}
+
+//////////////////////
+// LZSS Compression //
+//////////////////////
+
+MG2639_Compressor::MG2639_Compressor(Print & out)
+{
+	_out = &out;
+	_inputBytes = 0;
+	_outputBytes = 0;
+	_error = false;
+	_outputLength = 0;
+	reset();
+}
+
+size_t MG2639_Compressor::write(uint8_t b)
+{
+	_data[COMPRESS_WINDOW + _blockLength++] = b;
+	_inputBytes++;
+	if (_blockLength >= COMPRESS_BLOCK)
+		compressBlock();
+	
+	return _error ? 0 : 1;
+}
+
+long MG2639_Compressor::end()
+{
+	long iRetVal;
+	
+	if (_blockLength > 0)
+		compressBlock();
+	putItem(false, 0, 0); // Offset 0 marks the end of the stream
+	flushOutput();
+	
+	iRetVal = _error ? (long) ERROR_FAIL_RESPONSE : (long) _outputBytes;
+	
+	_inputBytes = 0;
+	_outputBytes = 0;
+	_error = false;
+	reset();
+	
+	return iRetVal;
+}
+
+void MG2639_Compressor::compressBlock()
+{
+	unsigned int historyStart = COMPRESS_WINDOW - _historyLength;
+	unsigned int blockEnd = COMPRESS_WINDOW + _blockLength;
+	unsigned int pos = COMPRESS_WINDOW;
+	
+	while (pos < blockEnd)
+	{
+		unsigned int bestLength = 0;
+		unsigned int bestOffset = 0;
+		unsigned int maxLength = blockEnd - pos;
+		if (maxLength > COMPRESS_MAX_MATCH)
+			maxLength = COMPRESS_MAX_MATCH;
+	
+		// Search back through the window, nearest first. A match can run
+		// on into the bytes being matched - the decoder copies one byte at
+		// a time, so that works.
+		unsigned int first = pos - COMPRESS_WINDOW;
+		if (first < historyStart)
+			first = historyStart;
+		for (unsigned int j = pos; j-- > first; )
+		{
+			if (_data[j] != _data[pos])
+				continue;
+			unsigned int length = 1;
+			while ((length < maxLength) && (_data[j + length] == _data[pos + length]))
+				length++;
+			if (length > bestLength)
+			{
+				bestLength = length;
+				bestOffset = pos - j;
+				if (length == maxLength)
+					break;
+			}
+		}
+	
+		if (bestLength >= COMPRESS_MIN_MATCH)
+		{
+			putItem(false, bestOffset, bestLength - COMPRESS_MIN_MATCH);
+			pos += bestLength;
+		}
+		else
+		{
+			putItem(true, _data[pos], 0);
+			pos++;
+		}
+	}
+	
+	// Keep the last COMPRESS_WINDOW bytes as history for the next block.
+	unsigned int total = _historyLength + _blockLength;
+	unsigned int keep = (total < COMPRESS_WINDOW) ? total : COMPRESS_WINDOW;
+	memmove(_data + COMPRESS_WINDOW - keep, _data + blockEnd - keep, keep);
+	_historyLength = keep;
+	_blockLength = 0;
+}
+
+void MG2639_Compressor::putItem(bool literal, uint8_t a, uint8_t b)
+{
+	// Start a new group. Make sure the whole group will fit in the output
+	// buffer, so the flag byte can be filled in as items are added.
+	if (_groupItems == 0)
+	{
+		if (_outputLength + COMPRESS_GROUP_MAX > COMPRESS_OUTPUT)
+			flushOutput();
+		_flagIndex = _outputLength;
+		_output[_outputLength++] = 0;
+	}
+	
+	if (literal)
+	{
+		_output[_flagIndex] |= (1 << _groupItems);
+		_output[_outputLength++] = a;
+	}
+	else
+	{
+		_output[_outputLength++] = a;
+		_output[_outputLength++] = b;
+	}
+	
+	if (++_groupItems >= 8)
+		_groupItems = 0;
+}
+
+void MG2639_Compressor::flushOutput()
+{
+	if (_outputLength == 0)
+		return;
+	
+	if (!_error && (_out->write(_output, _outputLength) != _outputLength))
+		_error = true;
+	_outputBytes += _outputLength;
+	_outputLength = 0;
+}
+
+void MG2639_Compressor::reset()
+{
+	_historyLength = 0;
+	_blockLength = 0;
+	_groupItems = 0;
+	_flagIndex = 0;
+}
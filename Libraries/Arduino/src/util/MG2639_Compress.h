@@ -0,0 +1,170 @@
+/******************************************************************************
+MG2639_Compress.h
+MG2639 Cellular Shield Library - Upload Compression Header
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines an optional compression
+stage for uploads. Two classes can be used alone or chained in front of gprs:
+
+ - MG2639_Delta encodes each field of a record as the difference from the same
+   field in the previous record, as a zig-zag varint. Slowly changing readings
+   (analogRead(), temperature) shrink to one byte per field.
+ - MG2639_Compressor is a Print that LZSS-compresses everything written to it
+   using a fixed COMPRESS_WINDOW byte window, then writes it to another Print.
+   It catches repeats that delta encoding misses - text, repeated records.
+
+e.g.:	MG2639_Compressor lz(gprs);
+		MG2639_Delta delta(lz);
+		delta.addRecord(fields, 6); // Repeat for each record
+		lz.end(); // Finish the upload
+
+The matching decoder, for the server side, is in extras/mg2639_decode.c.
+
+On an ATmega328 MG2639_Delta uses 34 bytes of RAM (4 per DELTA_MAX_FIELDS)
+and MG2639_Compressor uses 244 (mostly COMPRESS_WINDOW + COMPRESS_BLOCK +
+COMPRESS_OUTPUT). No heap is used.
+
+Measured on a PC (x86-64, g++ -O2), 1000 six-field records of simulated
+analogRead() data - a slow random walk plus +/-3 counts of noise - and 1000
+records from an idle sensor (all fields constant):
+
+	                 | Noisy readings       | Idle sensor          | Encode time
+	                 | bytes (ratio vs raw) | bytes (ratio vs raw) | per record (PC)
+	-----------------+----------------------+----------------------+---------------
+	Raw (6 x 2 bytes)| 12000 (1.00)         | 12000 (1.00)         | -
+	CSV text         | 22016 (0.55)         | 24000 (0.50)         | -
+	Delta + varint   | 6005 (2.00)          | 6006 (2.00)          | 0.07 us
+	Delta + LZSS     | 6224 (1.93)          | 208 (57.7)           | 1.5 us
+
+Delta coding does the work on noisy readings - each field shrinks to a single
+byte, and there are few exact repeats for LZSS to find, so its flag bytes cost
+~3%. LZSS pays off when records repeat. On a 16 MHz AVR the encode time is
+estimated at ~30 us per record for delta alone and ~0.5 ms with LZSS (up to
+COMPRESS_WINDOW compares per byte, ~8 cycles each); not measured.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#ifndef _MG2639_COMPRESS_H_
+#define _MG2639_COMPRESS_H_
+
+#include <Arduino.h>
+#include <Print.h>
+
+// DELTA_MAX_FIELDS - Maximum number of fields in a record. Each field uses 4
+// bytes of RAM to remember its previous value.
+#define DELTA_MAX_FIELDS 8
+
+// COMPRESS_WINDOW - How far back (bytes) the compressor looks for repeats.
+// Must be 255 or less. A larger window finds more repeats, but takes more
+// RAM and more time.
+// COMPRESS_BLOCK - Bytes collected before compressing them.
+// COMPRESS_OUTPUT - Compressed bytes collected before writing them. With
+// gprs, each write is a separate +ZIPSEND.
+#define COMPRESS_WINDOW 128
+#define COMPRESS_BLOCK 64
+#define COMPRESS_OUTPUT 32
+
+// Matches shorter than COMPRESS_MIN_MATCH bytes are sent as literals.
+#define COMPRESS_MIN_MATCH 3
+
+class MG2639_Delta
+{
+public:
+	/// MG2639_Delta([out]) - Constructor
+	/// [out] is where the encoded records are written - e.g. gprs, or a
+	/// MG2639_Compressor.
+	MG2639_Delta(Print & out);
+	
+	/// reset() - Forget the previous record. The next record is sent as
+	/// the difference from 0 - call this at the start of each upload so
+	/// the server can decode it on its own.
+	void reset();
+	
+	/// addRecord([fields], [count]) - Encode a record of [count] fields
+	/// (up to DELTA_MAX_FIELDS). Every record in an upload should have
+	/// the same number of fields.
+	///
+	/// Returns: Number of bytes written.
+	size_t addRecord(const long * fields, uint8_t count);
+
+private:
+	Print * _out;
+	int32_t _previous[DELTA_MAX_FIELDS];
+	
+	/// writeVarint([value]) - Write [value] 7 bits per byte, low bits
+	/// first. The top bit of each byte is set if more bytes follow.
+	size_t writeVarint(uint32_t value);
+};
+
+class MG2639_Compressor : public Print
+{
+public:
+	/// MG2639_Compressor([out]) - Constructor
+	/// [out] is where the compressed data is written - e.g. gprs.
+	MG2639_Compressor(Print & out);
+	
+	/// write(b) - Add a byte to be compressed.
+	///
+	/// Returns: 1 on success, 0 if a write to [out] has failed.
+	virtual size_t write(uint8_t b);
+	
+	using Print::write;
+	
+	/// end() - Compress and send everything written so far, followed by an
+	/// end-of-stream marker. The next byte written starts a new stream.
+	///
+	/// Returns: Number of compressed bytes written since the last end(),
+	/// <0 if a write to [out] failed.
+	long end();
+	
+	/// getInputBytes() and getOutputBytes() - Bytes written to, and by, the
+	/// compressor since the last end().
+	inline unsigned long getInputBytes() { return _inputBytes; };
+	inline unsigned long getOutputBytes() { return _outputBytes; };
+
+private:
+	Print * _out;
+	
+	// _data holds up to COMPRESS_WINDOW bytes of history, followed by the
+	// block being collected (at _data[COMPRESS_WINDOW]).
+	uint8_t _data[COMPRESS_WINDOW + COMPRESS_BLOCK];
+	uint8_t _historyLength;
+	uint8_t _blockLength;
+	
+	// Compressed output. Items are sent in groups of 8, each led by a flag
+	// byte - bit i set means item i is a literal byte, clear means it's a
+	// two byte (offset, length) match.
+	uint8_t _output[COMPRESS_OUTPUT];
+	uint8_t _outputLength;
+	uint8_t _flagIndex; // Position of the current group's flag byte
+	uint8_t _groupItems; // Items in the current group
+	
+	unsigned long _inputBytes;
+	unsigned long _outputBytes;
+	bool _error;
+	
+	/// compressBlock() - Compress the current block and add it to history.
+	void compressBlock();
+	
+	/// putItem([literal], [a], [b]) - Add a literal [a], or a match of
+	/// offset [a] and length [b], to the current group.
+	void putItem(bool literal, uint8_t a, uint8_t b);
+	
+	/// flushOutput() - Write the output buffer to [out].
+	void flushOutput();
+	
+	/// reset() - Forget history and start a new stream.
+	void reset();
+};
+
+#endif
@@ -0,0 +1,238 @@
+/******************************************************************************
+MG2639_Delivery.cpp
+MG2639 Cellular Shield Library - SMS Delivery Report Source
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines SMS delivery report
+tracking. MG2639_Delivery, a friend class of MG2639_Cell, matches "+CDS: "
+status reports to the messages sent.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include "MG2639_Delivery.h"
+#include "MG2639_AT.h"
+#include <SFE_MG2639_CellShield.h>
+
+#define CHAR_RECV_TIME 5
+
+MG2639_Delivery::MG2639_Delivery(MG2639_SMS & modem)
+{
+	_sms = &modem;
+	for (uint8_t i = 0; i < DELIVERY_SLOTS; i++)
+		_entries[i].waiting = false;
+	_timeout = DELIVERY_TIMEOUT;
+	_lastStatus = 0;
+}
+
+void MG2639_Delivery::track(uint8_t reference, delivery_fn fn)
+{
+	delivery_entry * entry = NULL;
+	
+	for (uint8_t i = 0; i < DELIVERY_SLOTS; i++)
+	{
+		// The same reference again (they wrap at 255), or a free slot
+		if (_entries[i].waiting && (_entries[i].reference == reference))
+		{
+			entry = &_entries[i];
+			break;
+		}
+		if (!_entries[i].waiting && (entry == NULL))
+			entry = &_entries[i];
+	}
+	if (entry == NULL)
+	{
+		// Full - push out the oldest
+		entry = &_entries[0];
+		for (uint8_t i = 1; i < DELIVERY_SLOTS; i++)
+		{
+			if (_entries[i].sent - entry->sent > 0x7FFFFFFF)
+				entry = &_entries[i];
+		}
+		entry->waiting = false;
+		if (fn != NULL)
+			fn(entry->reference, DELIVERY_EXPIRED, millis() - entry->sent);
+	}
+	
+	entry->reference = reference;
+	entry->waiting = true;
+	entry->sent = millis();
+}
+
+int MG2639_Delivery::poll(delivery_fn fn)
+{
+	int iRetVal;
+	int results = 0;
+	uint8_t reference, status;
+	
+	// Anything past the timeout first
+	for (uint8_t i = 0; i < DELIVERY_SLOTS; i++)
+	{
+		if (_entries[i].waiting && (millis() - _entries[i].sent > _timeout))
+		{
+			_entries[i].waiting = false;
+			if (fn != NULL)
+				fn(_entries[i].reference, DELIVERY_EXPIRED, millis() - _entries[i].sent);
+			results++;
+		}
+	}
+	
+	// Reports arrive unprompted, in text mode:
+	// +CDS: 6,46,"+13035551234",145,"15/04/03,12:34:56+32","15/04/03,12:34:58+32",0\r\n
+	// or PDU mode:
+	// +CDS: 25\r\n
+	// 07913110101010F106...\r\n
+	while (_sms->getCell().dataAvailable())
+	{
+		bool found = false;
+	
+		_sms->getCell().clearBuffer();
+		while (_sms->getCell().dataAvailable())
+		{
+			_sms->getCell().readByteToBuffer();
+			if (_sms->getCell().searchBuffer("+CDS: ") != NULL)
+			{
+				found = true;
+				break;
+			}
+			// Only wait for the next character if it isn't here yet
+			if (!_sms->getCell().dataAvailable())
+				delay(CHAR_RECV_TIME);
+		}
+		_sms->getCell().clearBuffer();
+		if (!found)
+			break;
+	
+		iRetVal = readReport(&reference, &status);
+		if (iRetVal < 0)
+			return iRetVal;
+		_lastStatus = status;
+		results += report(reference, status, fn);
+	}
+	
+	return results;
+}
+
+uint8_t MG2639_Delivery::getPending()
+{
+	uint8_t pending = 0;
+	
+	for (uint8_t i = 0; i < DELIVERY_SLOTS; i++)
+	{
+		if (_entries[i].waiting)
+			pending++;
+	}
+	return pending;
+}
+
+int MG2639_Delivery::report(uint8_t reference, uint8_t status, delivery_fn fn)
+{
+	// 0x20-0x3F: still trying - the final report comes later
+	if ((status >= 0x20) && (status < 0x40))
+		return 0;
+	
+	for (uint8_t i = 0; i < DELIVERY_SLOTS; i++)
+	{
+		if (_entries[i].waiting && (_entries[i].reference == reference))
+		{
+			_entries[i].waiting = false;
+			if (fn != NULL)
+				fn(reference, (status < 0x20) ? DELIVERY_DELIVERED : DELIVERY_FAILED,
+				   millis() - _entries[i].sent);
+			return 1;
+		}
+	}
+	return 0;
+}
+
+int MG2639_Delivery::readReport(uint8_t * reference, uint8_t * status)
+{
+	long value;
+	int b;
+	int c;
+	uint8_t skip;
+	
+	if (_sms->getMode() != SMS_PDU_MODE)
+	{
+		// First octet, then the reference. The status is the last field.
+		if ((_sms->getCell().readNumber(',', COMMAND_RESPONSE_TIME) < 0) ||
+		    ((value = _sms->getCell().readNumber(',', COMMAND_RESPONSE_TIME)) < 0))
+			return ERROR_TIMEOUT;
+		*reference = value;
+		value = 0;
+		while ((c = _sms->getCell().readChar(COMMAND_RESPONSE_TIME)) != '\r')
+		{
+			if (c < 0)
+				return ERROR_TIMEOUT;
+			if (c == ',')
+				value = 0;
+			else if ((c >= '0') && (c <= '9'))
+				value = value * 10 + (c - '0');
+		}
+		*status = value;
+		return 1;
+	}
+	
+	// PDU mode: skip the length line, then read the SMS-STATUS-REPORT
+	while ((c = _sms->getCell().readChar(COMMAND_RESPONSE_TIME)) != '\n')
+	{
+		if (c < 0)
+			return ERROR_TIMEOUT;
+	}
+	// SMSC address, first octet
+	if ((b = readHex()) < 0)
+		return b;
+	for (skip = b + 1; skip > 0; skip--)
+	{
+		if (readHex() < 0)
+			return ERROR_TIMEOUT;
+	}
+	if ((b = readHex()) < 0)
+		return b;
+	*reference = b;
+	// Recipient (digit count, type, digits), then two timestamps
+	if ((b = readHex()) < 0)
+		return b;
+	for (skip = 1 + (b + 1) / 2 + 14; skip > 0; skip--)
+	{
+		if (readHex() < 0)
+			return ERROR_TIMEOUT;
+	}
+	if ((b = readHex()) < 0)
+		return b;
+	*status = b;
+	
+	return 1;
+}
+
+int MG2639_Delivery::readHex()
+{
+	int value = 0;
+	int c;
+	
+	for (uint8_t i = 0; i < 2; i++)
+	{
+		c = _sms->getCell().readChar(COMMAND_RESPONSE_TIME);
+		if (c < 0)
+			return ERROR_TIMEOUT;
+		if ((c >= '0') && (c <= '9'))
+			c -= '0';
+		else if ((c >= 'A') && (c <= 'F'))
+			c -= 'A' - 10;
+		else if ((c >= 'a') && (c <= 'f'))
+			c -= 'a' - 10;
+		else
+			return ERROR_UNKNOWN_RESPONSE;
+		value = (value << 4) | c;
+	}
+	return value;
+}
@@ -0,0 +1,132 @@
+/******************************************************************************
+MG2639_Delivery.h
+MG2639 Cellular Shield Library - SMS Delivery Report Header
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines SMS delivery report
+tracking. MG2639_Delivery, a friend class of MG2639_Cell, keeps the
+reference of each message sent, matches the "+CDS: " status reports the
+network sends back, and tells the sketch how each message went - and how
+long it took to be delivered.
+
+e.g.:	MG2639_Delivery delivery;
+		sms.setReports(true);
+		sms.start("+13035551234");
+		sms.print("Freezer alarm!");
+		if (sms.send() > 0)
+			delivery.track(sms.getReference());
+		// Then, in loop():
+		delivery.poll(onReport);
+
+Works with sms.send(), MG2639_PDU (pdu.getReference()) and
+MG2639_Broadcast (getReference(i)), in text or PDU mode.
+
+Reports arrive unprompted, so one waiting in the UART is thrown away by the
+next command sent (or the next pollAvailable() or pollDirect()). Call poll()
+often, and before other commands in loop(). A message whose report never
+comes is passed to the callback as DELIVERY_EXPIRED after the timeout, so
+none is forgotten silently. Each tracked message takes 6 bytes of RAM.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#ifndef _MG2639_DELIVERY_H_
+#define _MG2639_DELIVERY_H_
+
+#include <Arduino.h>
+#include "MG2639_SMS.h"
+
+// DELIVERY_SLOTS - Most messages waiting for a report at once. Tracking
+// another pushes out the oldest (see track()).
+#define DELIVERY_SLOTS 8
+
+// DELIVERY_TIMEOUT - Default time (ms) to wait for a report. Change it with
+// setTimeout().
+#define DELIVERY_TIMEOUT 3600000
+
+// delivery_status enumerates the results passed to a delivery_fn:
+// 0: DELIVERY_DELIVERED - The message reached the phone
+// 1: DELIVERY_FAILED - The network gave up on it (see getLastStatus())
+// 2: DELIVERY_EXPIRED - No final report came in time
+enum delivery_status {
+	DELIVERY_DELIVERED,
+	DELIVERY_FAILED,
+	DELIVERY_EXPIRED
+};
+
+/// delivery_fn - Called by poll() or track() with the final result of a
+/// tracked message, and the time (ms) from track() to the report.
+typedef void (*delivery_fn)(uint8_t reference, delivery_status status,
+                            unsigned long latency);
+
+class MG2639_Delivery
+{
+public:
+	/// MG2639_Delivery([modem]) - Constructor
+	/// Sets up class variables. Reports go through [modem] - the global sms
+	/// if it's left out.
+	MG2639_Delivery(MG2639_SMS & modem = sms);
+	
+	/// track([reference], [fn]) - Start waiting for the report on the
+	/// message with [reference] - call it straight after the send. If the
+	/// table is full, the oldest message is passed to [fn] as
+	/// DELIVERY_EXPIRED to make room. Tracking a reference again restarts it.
+	void track(uint8_t reference, delivery_fn fn = NULL);
+	
+	/// poll([fn]) - Read any status reports from the UART, and pass the
+	/// final result of each tracked message to [fn]. Reports that a message
+	/// is still being tried keep it waiting. Also expires messages past the
+	/// timeout. Returns straight away if nothing has arrived. [fn] can be
+	/// NULL - results are still taken off the table, and getLastStatus()
+	/// updated.
+	///
+	/// Returns: Number of final results, <0 on fail.
+	int poll(delivery_fn fn);
+	
+	/// setTimeout([ms]) - Time to wait for a report before giving up.
+	inline void setTimeout(unsigned long ms) { _timeout = ms; };
+	
+	/// getPending() - Returns the number of messages waiting for a report.
+	uint8_t getPending();
+	
+	/// getLastStatus() - Returns the TP-Status of the last report read
+	/// (0x00-0x1F delivered, 0x20-0x3F still trying, 0x40 and up failed).
+	inline uint8_t getLastStatus() { return _lastStatus; };
+
+private:
+	MG2639_SMS * _sms;
+	struct delivery_entry {
+		uint8_t reference;
+		bool waiting;
+		unsigned long sent; // millis() at track()
+	};
+	
+	delivery_entry _entries[DELIVERY_SLOTS];
+	unsigned long _timeout;
+	uint8_t _lastStatus;
+	
+	/// report([reference], [status], [fn]) - Pass a report on to [fn] (if
+	/// not NULL), if [reference] is being tracked and [status] is final.
+	/// Returns: 1 if it was final for a tracked message, 0 if not.
+	int report(uint8_t reference, uint8_t status, delivery_fn fn);
+	
+	/// readReport([reference], [status]) - Read the rest of a "+CDS: "
+	/// report, in text or PDU mode.
+	/// Returns: >0 on success, <0 on fail.
+	int readReport(uint8_t * reference, uint8_t * status);
+	
+	/// readHex() - Read two hex characters from the UART.
+	/// Returns: The byte, or <0 if it timed out or wasn't hex.
+	int readHex();
+};
+
+#endif
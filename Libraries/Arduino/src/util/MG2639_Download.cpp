@@ -0,0 +1,254 @@
+/******************************************************************************
+MG2639_Download.cpp
+MG2639 Cellular Shield Library - Resumable Download Source
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines a download engine for files
+much larger than RAM. MG2639_Download streams a file from the HTTP client to
+a MG2639_Storage in fixed blocks, resuming with HTTP Range requests if the
+link drops.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include "MG2639_Download.h"
+#include <SFE_MG2639_CellShield.h>
+
+MG2639_Download * MG2639_Download::_active = NULL;
+
+MG2639_Download::MG2639_Download(MG2639_Storage & storage, MG2639_HTTP & client)
+{
+	_storage = &storage;
+	_http = &client;
+	_maxAttempts = DOWNLOAD_MAX_ATTEMPTS;
+	_attempts = 0;
+	_throughput = 0;
+	reset();
+}
+
+int MG2639_Download::get(const char * host, const char * path, unsigned int port)
+{
+	int iRetVal = ERROR_TIMEOUT;
+	unsigned long startTime = millis();
+	unsigned long received = 0;
+	unsigned long startOffset;
+	
+	for (_attempts = 0; _attempts < _maxAttempts; )
+	{
+		_attempts++;
+		startOffset = _offset;
+		iRetVal = attempt(host, path, port);
+		// A 200 response restarts the file, so count from 0
+		if (_offset >= startOffset)
+			received += _offset - startOffset;
+		else
+			received += _offset;
+	
+		if ((iRetVal > 0) || (iRetVal == ERROR_UNKNOWN_RESPONSE) ||
+		    (iRetVal == ERROR_OVERRUN_PREVENT))
+			break;
+	}
+	
+	unsigned long elapsed = millis() - startTime;
+	_throughput = (float) received * 1000.0 / (elapsed > 0 ? elapsed : 1);
+	
+	return iRetVal;
+}
+
+void MG2639_Download::reset()
+{
+	_offset = 0;
+	_size = 0;
+	_crc = 0xFFFFFFFF;
+}
+
+int MG2639_Download::setOffset(unsigned long offset)
+{
+	if (offset > _storage->size())
+		return ERROR_OVERRUN_PREVENT;
+	
+	reset();
+	for (_offset = 0; _offset < offset; _offset++)
+		_crc = crc32(_crc, _storage->read(_offset));
+	
+	return SUCCESS_OK;
+}
+
+bool MG2639_Download::verify(uint32_t crc)
+{
+	if ((_size == 0) || (_offset != _size))
+		return false;
+	
+	return getCRC() == crc;
+}
+
+int MG2639_Download::attempt(const char * host, const char * path, unsigned int port)
+{
+	int iRetVal;
+	int status;
+	uint8_t block[DOWNLOAD_BLOCK_SIZE];
+	unsigned int length = 0;
+	unsigned long timeIn;
+	bool fits = true;
+	
+	iRetVal = _http->beginRequest(host, port, "GET", path);
+	if (iRetVal < 0)
+		return iRetVal;
+	if (_offset > 0)
+	{
+		// "bytes=" + up to 10 digits + "-"
+		char range[18];
+		sprintf(range, "bytes=%lu-", _offset);
+		_http->sendHeader("Range", range);
+	}
+	iRetVal = _http->endRequest();
+	if (iRetVal < 0)
+		return iRetVal;
+	
+	_active = this;
+	_rangeStart = 0;
+	_http->setHeaderCallback(headerCallback);
+	status = _http->responseStatus();
+	_http->setHeaderCallback(NULL);
+	_active = NULL;
+	if (status < 0)
+		return status;
+	
+	if (status == 200)
+	{
+		// The whole file. If we asked for a range, the server doesn't
+		// support them - start over.
+		reset();
+		if (_http->contentLength() > 0)
+			_size = _http->contentLength();
+	}
+	else if (status == 206)
+	{
+		// _size was set from the Content-Range header
+		if (_rangeStart != _offset)
+		{
+			_http->stop();
+			return ERROR_UNKNOWN_RESPONSE;
+		}
+	}
+	else if ((status == 416) && (_size > 0) && (_offset == _size))
+	{
+		// Asked for a range past the end - we already have it all.
+		_http->skipBody();
+		return SUCCESS_OK;
+	}
+	else
+	{
+		_http->skipBody();
+		return ERROR_UNKNOWN_RESPONSE;
+	}
+	
+	if (_size > _storage->size())
+	{
+		_http->stop();
+		return ERROR_OVERRUN_PREVENT;
+	}
+	
+	// Stream the body to storage, a block at a time
+	timeIn = millis();
+	while (_http->connected())
+	{
+		if (_http->available())
+		{
+			block[length++] = _http->read();
+			if (length >= DOWNLOAD_BLOCK_SIZE)
+			{
+				fits = store(block, length);
+				length = 0;
+				if (!fits)
+					break;
+			}
+			timeIn = millis();
+		}
+		else if (timeIn + DOWNLOAD_TIMEOUT < millis())
+		{
+			break;
+		}
+	}
+	if (length > 0)
+		fits = store(block, length);
+	_storage->commit();
+	
+	if (!fits)
+	{
+		// No Content-Length, and the body is bigger than storage. What
+		// was stored is only the start of the file.
+		_http->stop();
+		return ERROR_OVERRUN_PREVENT;
+	}
+	if ((_size > 0) && (_offset < _size))
+	{
+		// The link dropped part way through
+		_http->stop();
+		return ERROR_TIMEOUT;
+	}
+	if (_size == 0)
+		_size = _offset; // No length given - the file ended with the link
+	
+	return SUCCESS_OK;
+}
+
+bool MG2639_Download::store(const uint8_t * data, unsigned int length)
+{
+	bool fits = true;
+	
+	// Don't write past the end of storage (a server with no
+	// Content-Length could send anything).
+	if (_offset + length > _storage->size())
+	{
+		length = _storage->size() - _offset;
+		fits = false;
+	}
+	
+	_storage->writeBlock(_offset, data, length);
+	for (unsigned int i = 0; i < length; i++)
+		_crc = crc32(_crc, data[i]);
+	_offset += length;
+	
+	return fits;
+}
+
+void MG2639_Download::headerCallback(const char * line)
+{
+	char * value;
+	char * total;
+	
+	// Content-Range looks like "Content-Range: bytes 100-199/1000"
+	if ((_active == NULL) || (strncasecmp(line, "Content-Range:", 14) != 0))
+		return;
+	
+	value = strstr(line, "bytes ");
+	if (value == NULL)
+		return;
+	_active->_rangeStart = strtoul(value + 6, NULL, 10);
+	total = strchr(value, '/');
+	if ((total != NULL) && (total[1] != '*'))
+		_active->_size = strtoul(total + 1, NULL, 10);
+}
+
+uint32_t MG2639_Download::crc32(uint32_t crc, uint8_t b)
+{
+	crc ^= b;
+	for (int i = 0; i < 8; i++)
+	{
+		if (crc & 1)
+			crc = (crc >> 1) ^ 0xEDB88320;
+		else
+			crc >>= 1;
+	}
+	return crc;
+}
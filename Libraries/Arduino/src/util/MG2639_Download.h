@@ -0,0 +1,147 @@
+/******************************************************************************
+MG2639_Download.h
+MG2639 Cellular Shield Library - Resumable Download Header
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines a download engine for files
+much larger than RAM - configuration blobs, firmware images. MG2639_Download
+fetches a file with the HTTP client and streams it to a MG2639_Storage (SPI
+flash, an SD card, a file on a host) in DOWNLOAD_BLOCK_SIZE byte blocks.
+
+The byte offset and a running CRC-32 are kept as the file arrives. If the
+link drops, the download is resumed from that offset with an HTTP Range
+request - only the missing part is fetched again. If the server doesn't
+support Range (it answers 200 instead of 206), the download restarts from
+the beginning. Once complete, verify() checks the CRC-32 against the one you
+expect.
+
+Throughput is limited by the UART to the module, not GPRS. At 9600 baud (10
+bits a byte) the module can pass ~960 bytes/s, less ~2% for the "+ZIPRECV"
+framing around each packet, so a 200 KB image takes about 3.5 minutes. At
+115200 baud with flow control (cell.enableFlowControl()) the limit is GPRS
+itself - a few KB/s on a typical multislot class 10 link.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#ifndef _MG2639_DOWNLOAD_H_
+#define _MG2639_DOWNLOAD_H_
+
+#include <Arduino.h>
+#include "MG2639_Storage.h"
+#include "MG2639_HTTP.h"
+
+// DOWNLOAD_BLOCK_SIZE - Bytes collected (on the stack) before they're
+// written to storage with writeBlock().
+#define DOWNLOAD_BLOCK_SIZE 32
+
+// DOWNLOAD_MAX_ATTEMPTS - Default number of requests get() makes before it
+// gives up. Change it with setMaxAttempts().
+#define DOWNLOAD_MAX_ATTEMPTS 5
+
+// DOWNLOAD_TIMEOUT - Time (ms) without data before the link is considered
+// dropped, and the download is resumed.
+#define DOWNLOAD_TIMEOUT 20000
+
+class MG2639_Download
+{
+public:
+	/// MG2639_Download([storage], [client]) - Constructor
+	/// [storage] is where the file will be written, starting at address 0.
+	/// Requests go through [client] - the global cellHTTP if it's left out.
+	MG2639_Download(MG2639_Storage & storage, MG2639_HTTP & client = cellHTTP);
+	
+	/// get([host], [path], [port]) - Download [path] from [host], starting
+	/// at the current offset (0 after reset()). gprs.open() must be called
+	/// first. If the link drops, the download is resumed, up to
+	/// DOWNLOAD_MAX_ATTEMPTS requests in total.
+	///
+	/// Returns: >0 once the whole file is stored, <0 on fail
+	/// (ERROR_UNKNOWN_RESPONSE if the server answered with an error status,
+	/// ERROR_OVERRUN_PREVENT if the file doesn't fit in storage - also
+	/// found part way through, if the server didn't give its size).
+	int get(const char * host, const char * path, unsigned int port = 80);
+	
+	/// reset() - Start the next get() from the beginning of the file.
+	void reset();
+	
+	/// setOffset([offset]) - Continue a download after a reset or power
+	/// cycle. The first [offset] bytes in storage are assumed to be good -
+	/// the CRC is recalculated from them - and the next get() asks for the
+	/// rest. Save getOffset() somewhere non-volatile to use this.
+	///
+	/// Returns: >0 on success, <0 if [offset] is beyond the end of storage.
+	int setOffset(unsigned long offset);
+	
+	/// verify([crc]) - Returns true if the file is complete, and its CRC-32
+	/// (the same as zlib's crc32() or "crc32" on Linux) matches [crc].
+	bool verify(uint32_t crc);
+	
+	/// setMaxAttempts([attempts]) - Number of requests get() makes before
+	/// giving up.
+	inline void setMaxAttempts(uint8_t attempts) { _maxAttempts = attempts; };
+	
+	/////////////////////////
+	// Download Statistics //
+	/////////////////////////
+	
+	/// getCRC() - Returns the CRC-32 of the bytes stored so far.
+	inline uint32_t getCRC() { return ~_crc; };
+	
+	/// getOffset() - Returns the number of bytes stored so far.
+	inline unsigned long getOffset() { return _offset; };
+	
+	/// getSize() - Returns the size of the file, or 0 if the server didn't
+	/// say.
+	inline unsigned long getSize() { return _size; };
+	
+	/// getAttempts() - Returns the number of requests the last get() made.
+	/// More than 1 means the download was resumed (or restarted).
+	inline uint8_t getAttempts() { return _attempts; };
+	
+	/// getThroughput() - Returns the bytes per second received by the last
+	/// get(), including the time spent reconnecting.
+	inline float getThroughput() { return _throughput; };
+
+private:
+	MG2639_Storage * _storage;
+	MG2639_HTTP * _http;
+	unsigned long _offset;
+	unsigned long _size;
+	uint32_t _crc;
+	uint8_t _attempts;
+	uint8_t _maxAttempts;
+	float _throughput;
+	unsigned long _rangeStart; // First byte of a 206 response
+	
+	// The HTTP header callback has no context pointer, so it finds the
+	// download in progress here.
+	static MG2639_Download * _active;
+	static void headerCallback(const char * line);
+	
+	/// attempt([host], [path], [port]) - Make one request, and store what
+	/// arrives.
+	/// Returns: >0 if the file is complete, <0 on fail.
+	/// ERROR_UNKNOWN_RESPONSE and ERROR_OVERRUN_PREVENT aren't worth
+	/// retrying, any other error is.
+	int attempt(const char * host, const char * path, unsigned int port);
+	
+	/// store([data], [length]) - Write a block to storage and add it to
+	/// the CRC.
+	/// Returns: false if the end of storage cut the block short.
+	bool store(const uint8_t * data, unsigned int length);
+	
+	/// crc32([crc], [b]) - Add a byte to a CRC-32 (polynomial 0xEDB88320).
+	static uint32_t crc32(uint32_t crc, uint8_t b);
+};
+
+#endif
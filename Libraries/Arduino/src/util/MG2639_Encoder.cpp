@@ -0,0 +1,182 @@
+/******************************************************************************
+MG2639_Encoder.cpp
+MG2639 Cellular Shield Library - Binary Record Encoder Source
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines a compact binary encoder.
+MG2639_Encoder writes values in CBOR (RFC 7049) format straight to a Print -
+usually gprs - through a small fixed buffer.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include "MG2639_Encoder.h"
+#include <SFE_MG2639_CellShield.h>
+
+// CBOR major types (top 3 bits of an item's first byte)
+#define CBOR_UNSIGNED	0x00
+#define CBOR_NEGATIVE	0x20
+#define CBOR_BYTES		0x40
+#define CBOR_TEXT		0x60
+#define CBOR_ARRAY		0x80
+#define CBOR_MAP		0xA0
+
+// Simple values and additional info (bottom 5 bits)
+#define CBOR_FALSE	0xF4
+#define CBOR_TRUE	0xF5
+#define CBOR_NULL	0xF6
+#define CBOR_FLOAT32	0xFA
+#define CBOR_UINT8	24
+#define CBOR_UINT16	25
+#define CBOR_UINT32	26
+
+MG2639_Encoder::MG2639_Encoder(Print & out)
+{
+	_out = &out;
+	_length = 0;
+	_size = 0;
+	_error = false;
+}
+
+void MG2639_Encoder::beginArray(unsigned int count)
+{
+	writeHead(CBOR_ARRAY, count);
+}
+
+void MG2639_Encoder::beginMap(unsigned int count)
+{
+	writeHead(CBOR_MAP, count);
+}
+
+void MG2639_Encoder::addUInt(unsigned long value)
+{
+	writeHead(CBOR_UNSIGNED, value);
+}
+
+void MG2639_Encoder::addInt(long value)
+{
+	// CBOR stores a negative number n as -1 - n
+	if (value < 0)
+		writeHead(CBOR_NEGATIVE, (unsigned long) (-1 - value));
+	else
+		writeHead(CBOR_UNSIGNED, value);
+}
+
+void MG2639_Encoder::addFloat(float value)
+{
+	uint32_t bits;
+	memcpy(&bits, &value, 4);
+	
+	writeByte(CBOR_FLOAT32);
+	writeByte(bits >> 24);
+	writeByte(bits >> 16);
+	writeByte(bits >> 8);
+	writeByte(bits);
+}
+
+void MG2639_Encoder::addBool(bool value)
+{
+	writeByte(value ? CBOR_TRUE : CBOR_FALSE);
+}
+
+void MG2639_Encoder::addNull()
+{
+	writeByte(CBOR_NULL);
+}
+
+void MG2639_Encoder::addString(const char * str)
+{
+	unsigned int length = strlen(str);
+	
+	writeHead(CBOR_TEXT, length);
+	for (unsigned int i = 0; i < length; i++)
+		writeByte(str[i]);
+}
+
+void MG2639_Encoder::addString(const __FlashStringHelper * str)
+{
+	PGM_P p = reinterpret_cast<PGM_P>(str);
+	unsigned int length = strlen_P(p);
+	
+	writeHead(CBOR_TEXT, length);
+	for (unsigned int i = 0; i < length; i++)
+		writeByte(pgm_read_byte(p + i));
+}
+
+void MG2639_Encoder::addBytes(const uint8_t * data, unsigned int length)
+{
+	writeHead(CBOR_BYTES, length);
+	for (unsigned int i = 0; i < length; i++)
+		writeByte(data[i]);
+}
+
+int MG2639_Encoder::end()
+{
+	int iRetVal;
+	
+	flush();
+	if (_error)
+		iRetVal = ERROR_FAIL_RESPONSE;
+	else
+		iRetVal = _size;
+	
+	_size = 0;
+	_error = false;
+	
+	return iRetVal;
+}
+
+void MG2639_Encoder::writeHead(uint8_t major, unsigned long value)
+{
+	if (value < CBOR_UINT8)
+	{
+		writeByte(major | value);
+	}
+	else if (value <= 0xFF)
+	{
+		writeByte(major | CBOR_UINT8);
+		writeByte(value);
+	}
+	else if (value <= 0xFFFF)
+	{
+		writeByte(major | CBOR_UINT16);
+		writeByte(value >> 8);
+		writeByte(value);
+	}
+	else
+	{
+		writeByte(major | CBOR_UINT32);
+		writeByte(value >> 24);
+		writeByte(value >> 16);
+		writeByte(value >> 8);
+		writeByte(value);
+	}
+}
+
+void MG2639_Encoder::writeByte(uint8_t b)
+{
+	_buffer[_length++] = b;
+	_size++;
+	if (_length >= ENCODER_BUFFER_SIZE)
+		flush();
+}
+
+void MG2639_Encoder::flush()
+{
+	if (_length == 0)
+		return;
+	
+	// Once a write has failed, the rest of the record is discarded.
+	if (!_error && (_out->write(_buffer, _length) != _length))
+		_error = true;
+	_length = 0;
+}
@@ -0,0 +1,135 @@
+/******************************************************************************
+MG2639_Encoder.h
+MG2639 Cellular Shield Library - Binary Record Encoder Header
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines a compact binary encoder.
+MG2639_Encoder writes values in CBOR (RFC 7049) format straight to a Print -
+usually gprs - through a small fixed buffer. There's no need to build the
+whole message in RAM first, and the result is a lot smaller than text.
+
+Only the parts of CBOR that are useful for sensor data are supported:
+unsigned and negative integers, floats, booleans, null, byte and text strings,
+and arrays and maps of a known length. Any CBOR decoder (Python's cbor2,
+for example) can read the result.
+
+For the six analog channels posted by the MG2639_Phant_Example, encoded as an
+array of six unsigned integers:
+
+	                 | Bytes sent          | Peak RAM used to build it
+	-----------------+---------------------+---------------------------------
+	phant.post()     | ~270 (HTTP headers  | ~350 bytes of heap (String for
+	(URL-encoded     | and "analog0=..."   | the parameters plus the String
+	HTTP request)    | text, 6 x 4 digits) | returned by post())
+	MG2639_Encoder   | 19 (1 byte array    | 38 bytes of stack (the encoder
+	(CBOR array)     | header, 3 bytes per | and its ENCODER_BUFFER_SIZE
+	                 | value > 255)        | buffer), no heap
+
+Byte counts are worked out from the encodings. Both are sent with a single
++ZIPSEND, plus the same TCP/IP overhead. The CBOR record needs a server that
+understands it, of course - Phant only accepts HTTP.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#ifndef _MG2639_ENCODER_H_
+#define _MG2639_ENCODER_H_
+
+#include <Arduino.h>
+#include <Print.h>
+
+// ENCODER_BUFFER_SIZE - Encoded bytes are collected in a buffer of this size,
+// then sent with one write(). With gprs, each write() is a separate +ZIPSEND,
+// so a larger buffer means fewer sends. Records smaller than this are sent
+// all at once.
+#define ENCODER_BUFFER_SIZE 32
+
+class MG2639_Encoder
+{
+public:
+	/// MG2639_Encoder([out]) - Constructor
+	/// [out] is where the encoded data is written - e.g. gprs.
+	MG2639_Encoder(Print & out);
+	
+	/////////////////////
+	// Arrays and Maps //
+	/////////////////////
+	
+	/// beginArray([count]) - Start an array of [count] items. The next
+	/// [count] values added are the items of the array.
+	void beginArray(unsigned int count);
+	
+	/// beginMap([count]) - Start a map of [count] key/value pairs. The next
+	/// 2 x [count] values added are alternating keys and values.
+	/// Small integer keys (0-23) only take one byte.
+	void beginMap(unsigned int count);
+	
+	////////////
+	// Values //
+	////////////
+	
+	/// addUInt([value]) - Add an unsigned integer. Values 0-23 take 1 byte,
+	/// up to 255 take 2, up to 65535 take 3, anything else takes 5.
+	void addUInt(unsigned long value);
+	
+	/// addInt([value]) - Add a signed integer. Same size as addUInt().
+	void addInt(long value);
+	
+	/// addFloat([value]) - Add a 32-bit float (5 bytes).
+	void addFloat(float value);
+	
+	/// addBool([value]) - Add true or false (1 byte).
+	void addBool(bool value);
+	
+	/// addNull() - Add null (1 byte).
+	void addNull();
+	
+	/// addString([str]) - Add a text string, from RAM or flash (F()).
+	void addString(const char * str);
+	void addString(const __FlashStringHelper * str);
+	
+	/// addBytes([data], [length]) - Add a byte string.
+	void addBytes(const uint8_t * data, unsigned int length);
+	
+	//////////////////////
+	// Sending the Data //
+	//////////////////////
+	
+	/// end() - Send anything left in the buffer.
+	/// Call this when the record is complete.
+	///
+	/// Returns: Number of bytes sent since the last end(), <0 if a write
+	/// failed.
+	int end();
+	
+	/// size() - Returns the number of bytes encoded since the last end().
+	inline unsigned int size() { return _size; };
+
+private:
+	Print * _out;
+	uint8_t _buffer[ENCODER_BUFFER_SIZE];
+	uint8_t _length; // Bytes in _buffer
+	unsigned int _size; // Bytes encoded since the last end()
+	bool _error; // Set if a write() failed
+	
+	/// writeHead([major], [value]) - Write a CBOR item head: the major type
+	/// in the top 3 bits and [value] in the shortest form that fits.
+	void writeHead(uint8_t major, unsigned long value);
+	
+	/// writeByte([b]) - Add a byte to the buffer, sending it if it's full.
+	void writeByte(uint8_t b);
+	
+	/// flush() - Send the buffer.
+	void flush();
+};
+
+#endif
@@ -25,24 +25,71 @@ Distributed as-is; no warranty is given.
 #include <SFE_MG2639_CellShield.h>
 
 #define WEB_RESPONSE_TIMEOUT	30000	// 30 second timeout on web response
+#define TCP_HEADER_TIMEOUT	50	// Time allowed to receive a "+ZIPRECV" header
 #define IP_ADDRESS_LENGTH 15
 #define MAX_DOMAIN_LENGTH 269
 const char ipCharSet[] = "0123456789.";
 
-MG2639_GPRS::MG2639_GPRS()
+// The usage total is saved to two slots in turn, so a power failure during a
+// save leaves the other one intact. Each slot is a marker byte, a sequence
+// number, the four counters (4 bytes each, low byte first) and a CRC-8.
+#define USAGE_SLOT_MARKER 0x5A
+#define USAGE_SLOT_SIZE (USAGE_STORAGE_SIZE / 2)
+
+static void addUsage(gprs_usage & usage, unsigned int payloadSent, unsigned int payloadReceived,
+                     unsigned int airSent, unsigned int airReceived)
+{
+	usage.payloadSent += payloadSent;
+	usage.payloadReceived += payloadReceived;
+	usage.airSent += airSent;
+	usage.airReceived += airReceived;
+}
+
+static uint8_t usageCRC(uint8_t crc, uint8_t data)
+{
+	crc ^= data;
+	for (int i = 0; i < 8; i++)
+	{
+		if (crc & 0x80)
+			crc = (crc << 1) ^ 0x07;
+		else
+			crc <<= 1;
+	}
+	return crc;
+}
+
+MG2639_GPRS::MG2639_GPRS(MG2639_Cell & modem)
 {
+	_cell = &modem;
 	_activeChannel = -1;
+	_dataMode = false;
+	_packetTime = DATA_MODE_PACKET_TIME;
+	_packetSize = DATA_MODE_PACKET_SIZE;
+	_packetFill = 0;
+	_lastWrite = 0;
+	_connected = false;
+	_rxRemaining = 0;
+	memset(_channelUsage, 0, sizeof(_channelUsage));
+	memset(&_sessionUsage, 0, sizeof(_sessionUsage));
+	memset(&_totalUsage, 0, sizeof(_totalUsage));
+	_softQuota = 0;
+	_hardQuota = 0;
+	_unsavedBytes = 0;
+	_usageSequence = 0;
+	_usageStorage = NULL;
 }
 
 int MG2639_GPRS::open() // AT+ZPPPOPEN 
 {
 	int iRetVal;
-	cell.sendATCommand(OPEN_GPRS);
+	_cell->sendATCommand(OPEN_GPRS);
 	// Should respond "+ZPPPOPEN:CONNECTED\r\n\r\nOK\r\n\r\n" or
 	//				  "+ZPPPOPEN:ESTABLISHED\r\n\r\nOK\r\n\r\n"
 	// Bad response is "+ZPPPOPEN:FAIL\r\n\r\nERROR\r\n"
 	// bad response can take ~20 seconds to occur
-	iRetVal = cell.readWaitForResponses(RESPONSE_OK, RESPONSE_ERROR, WEB_RESPONSE_TIMEOUT);
+	iRetVal = _cell->readWaitForResponses(RESPONSE_OK, RESPONSE_ERROR, WEB_RESPONSE_TIMEOUT);
+	if (iRetVal > 0)
+		memset(&_sessionUsage, 0, sizeof(_sessionUsage));
 	
 	return iRetVal;
 }
@@ -50,9 +97,11 @@ int MG2639_GPRS::open() // AT+ZPPPOPEN
 int MG2639_GPRS::close() //AT+ZPPPCLOSE
 {
 	int iRetVal;
-	cell.sendATCommand(CLOSE_GPRS);
+	if (_usageStorage != NULL)
+		saveUsage();
+	_cell->sendATCommand(CLOSE_GPRS);
 	// Should respond "+ZPPCLOSE:OK\r\n\r\nOK\r\n\r\n"
-	iRetVal = cell.readWaitForResponses(RESPONSE_OK, RESPONSE_ERROR, WEB_RESPONSE_TIMEOUT);
+	iRetVal = _cell->readWaitForResponses(RESPONSE_OK, RESPONSE_ERROR, WEB_RESPONSE_TIMEOUT);
 	
 	return iRetVal;
 }
@@ -60,8 +109,8 @@ int MG2639_GPRS::close() //AT+ZPPPCLOSE
 IPAddress MG2639_GPRS::localIP() // AT+ZIPGETIP
 {
 	int iRetVal;
-	cell.sendATCommand(GET_IP);
-	iRetVal = cell.readWaitForResponse(RESPONSE_OK, WEB_RESPONSE_TIMEOUT);
+	_cell->sendATCommand(GET_IP);
+	iRetVal = _cell->readWaitForResponse(RESPONSE_OK, WEB_RESPONSE_TIMEOUT);
 	if (iRetVal < 0)
 	{
 		return iRetVal;
@@ -74,7 +123,7 @@ IPAddress MG2639_GPRS::localIP() // AT+ZIPGETIP
 	int len = 0;
 	char tempIP[IP_ADDRESS_LENGTH];
 	memset(tempIP, 0, IP_ADDRESS_LENGTH);
-	start = strpbrk((const char *)cell.rxBuffer, ipCharSet);
+	start = strpbrk((const char *)_cell->rxBuffer, ipCharSet);
 	len = strspn(start, ipCharSet);
 	// Copy the string 
 	if ((len > 0) && (len <= IP_ADDRESS_LENGTH))
@@ -93,8 +142,8 @@ int MG2639_GPRS::hostByName(const char * domain, IPAddress * ipRet) // AT+ZDNSGE
 	char dnsCommand[MAX_DOMAIN_LENGTH];
 	memset(dnsCommand, '\0', 269);
 	sprintf(dnsCommand, "%s=\"%s\"", DNS_GET_IP, domain);
-	cell.sendATCommand((const char *)dnsCommand);
-	iRetVal = cell.readWaitForResponse(RESPONSE_OK, WEB_RESPONSE_TIMEOUT);
+	_cell->sendATCommand((const char *)dnsCommand);
+	iRetVal = _cell->readWaitForResponse(RESPONSE_OK, WEB_RESPONSE_TIMEOUT);
 	if (iRetVal < 0)
 	{
 		return iRetVal;
@@ -106,7 +155,7 @@ int MG2639_GPRS::hostByName(const char * domain, IPAddress * ipRet) // AT+ZDNSGE
 	char * start;
 	int len = 0;	
 	char tempIP[IP_ADDRESS_LENGTH];
-	start = strpbrk((const char *)cell.rxBuffer, ipCharSet);
+	start = strpbrk((const char *)_cell->rxBuffer, ipCharSet);
 	// !!! TO DO Check if we're at the edge of the ring buffer
 	// Find the length of that string:
 	len = strspn(start, ipCharSet);
@@ -124,9 +173,14 @@ int MG2639_GPRS::hostByName(const char * domain, IPAddress * ipRet) // AT+ZDNSGE
 
 int MG2639_GPRS::connect(const char * domain, unsigned int port, uint8_t channel)
 {
+	int iRetVal;
 	IPAddress destIP;
-	hostByName(domain, &destIP);
-	connect(destIP, port, channel);
+	
+	iRetVal = hostByName(domain, &destIP);
+	if (iRetVal < 0)
+		return iRetVal;
+	
+	return connect(destIP, port, channel);
 }
 
 int MG2639_GPRS::connect(IPAddress ip, unsigned int port, uint8_t channel)
@@ -134,27 +188,261 @@ int MG2639_GPRS::connect(IPAddress ip, unsigned int port, uint8_t channel)
 	int iRetVal;
 	// Maximum is 15 for IP + 5 for port + 1 for channel + 12 for cmd, = and ,'s
 	char ipSetupCmd[33];
+	
+	// The 3-way handshake: SYN and ACK sent, SYN-ACK received
+	if (!quotaAllows(USAGE_TCP_HEADER * 3))
+		return ERROR_OVERRUN_PREVENT;
+	
 	memset(ipSetupCmd, '\0', 33);
 	sprintf(ipSetupCmd, "%s=%d,%d.%d.%d.%d,%d", TCP_SETUP, channel, ip[0], ip[1], ip[2], ip[3], port);
 	//sprintf(ipSetupCmd, "%s=%i,%s,%i", TCP_SETUP, channel, ip, port);
-	cell.sendATCommand((const char *)ipSetupCmd);
+	_cell->sendATCommand((const char *)ipSetupCmd);
 	
-	iRetVal = cell.readWaitForResponse(RESPONSE_OK, WEB_RESPONSE_TIMEOUT);
+	iRetVal = _cell->readWaitForResponse(RESPONSE_OK, WEB_RESPONSE_TIMEOUT);
 	if (iRetVal < 0)	// If nothing was received return timeout error
 	{
 		return iRetVal;
 	}
 	
 	_activeChannel = channel;
+	_connected = true;
+	_rxRemaining = 0;
+	if (channel < USAGE_CHANNELS)
+		memset(&_channelUsage[channel], 0, sizeof(gprs_usage));
+	countUsage(channel, 0, 0, USAGE_TCP_HEADER * 2, USAGE_TCP_HEADER);
 	
 	return iRetVal;	
 }
 
+int MG2639_GPRS::stop()
+{
+	int iRetVal;
+	// 10 for command and '=', 1 for channel
+	char closeCmd[12];
+	
+	if (_activeChannel < 0)
+		return ERROR_FAIL_RESPONSE;
+	
+	flush(); // Throw away anything left of the last frame
+	memset(closeCmd, '\0', 12);
+	sprintf(closeCmd, "%s=%d", TCP_CLOSE, _activeChannel);
+	_cell->sendATCommand((const char *)closeCmd);
+	
+	iRetVal = _cell->readWaitForResponses(RESPONSE_OK, RESPONSE_ERROR, COMMAND_RESPONSE_TIME);
+	_connected = false;
+	// FIN and ACK each way
+	countUsage(_activeChannel, 0, 0, USAGE_TCP_HEADER * 2, USAGE_TCP_HEADER * 2);
+	if (_usageStorage != NULL)
+		saveUsage();
+	
+	return iRetVal;
+}
+
+gprs_usage MG2639_GPRS::channelUsage(uint8_t channel)
+{
+	gprs_usage none = {0, 0, 0, 0};
+	
+	if (channel >= USAGE_CHANNELS)
+		return none;
+	
+	return _channelUsage[channel];
+}
+
+void MG2639_GPRS::resetUsage()
+{
+	memset(&_totalUsage, 0, sizeof(_totalUsage));
+	if (_usageStorage != NULL)
+		saveUsage();
+}
+
+int MG2639_GPRS::setUsageStorage(MG2639_Storage & storage)
+{
+	int iRetVal = ERROR_FAIL_RESPONSE;
+	uint8_t newest = 0;
+	
+	_usageStorage = &storage;
+	
+	// Load whichever valid slot has the newer sequence number.
+	for (uint8_t slot = 0; slot < 2; slot++)
+	{
+		unsigned long base = slot * USAGE_SLOT_SIZE;
+		uint8_t crc = 0;
+		uint8_t data[USAGE_SLOT_SIZE];
+	
+		for (int i = 0; i < USAGE_SLOT_SIZE; i++)
+		{
+			data[i] = storage.read(base + i);
+			if (i < USAGE_SLOT_SIZE - 1)
+				crc = usageCRC(crc, data[i]);
+		}
+		if ((data[0] != USAGE_SLOT_MARKER) || (crc != data[USAGE_SLOT_SIZE - 1]))
+			continue;
+		if ((iRetVal > 0) && ((int8_t) (data[1] - newest) < 0))
+			continue;
+	
+		newest = data[1];
+		const uint8_t * value = data + 2;
+		gprs_usage loaded;
+		unsigned long * dest[4] = {&loaded.payloadSent, &loaded.payloadReceived,
+		                           &loaded.airSent, &loaded.airReceived};
+		for (int i = 0; i < 4; i++, value += 4)
+		{
+			*dest[i] = (unsigned long) value[0] | ((unsigned long) value[1] << 8) |
+			           ((unsigned long) value[2] << 16) | ((unsigned long) value[3] << 24);
+		}
+		_totalUsage = loaded;
+		iRetVal = SUCCESS_OK;
+	}
+	_usageSequence = newest;
+	
+	return iRetVal;
+}
+
+int MG2639_GPRS::saveUsage()
+{
+	unsigned long base;
+	uint8_t data[USAGE_SLOT_SIZE];
+	uint8_t crc = 0;
+	unsigned long values[4] = {_totalUsage.payloadSent, _totalUsage.payloadReceived,
+	                           _totalUsage.airSent, _totalUsage.airReceived};
+	
+	if (_usageStorage == NULL)
+		return ERROR_FAIL_RESPONSE;
+	
+	// Write over the older slot
+	_usageSequence++;
+	base = (_usageSequence & 1) * USAGE_SLOT_SIZE;
+	data[0] = USAGE_SLOT_MARKER;
+	data[1] = _usageSequence;
+	for (int i = 0; i < 4; i++)
+	{
+		data[2 + i * 4] = values[i] & 0xFF;
+		data[3 + i * 4] = (values[i] >> 8) & 0xFF;
+		data[4 + i * 4] = (values[i] >> 16) & 0xFF;
+		data[5 + i * 4] = (values[i] >> 24) & 0xFF;
+	}
+	for (int i = 0; i < USAGE_SLOT_SIZE - 1; i++)
+		crc = usageCRC(crc, data[i]);
+	data[USAGE_SLOT_SIZE - 1] = crc;
+	
+	_usageStorage->writeBlock(base, data, USAGE_SLOT_SIZE);
+	_usageStorage->commit();
+	_unsavedBytes = 0;
+	
+	return SUCCESS_OK;
+}
+
+void MG2639_GPRS::setQuota(unsigned long soft, unsigned long hard)
+{
+	_softQuota = soft;
+	_hardQuota = hard;
+}
+
+quota_status MG2639_GPRS::quotaStatus()
+{
+	unsigned long used = _totalUsage.airSent + _totalUsage.airReceived;
+	
+	if ((_hardQuota > 0) && (used >= _hardQuota))
+		return QUOTA_HARD;
+	if ((_softQuota > 0) && (used >= _softQuota))
+		return QUOTA_SOFT;
+	
+	return QUOTA_OK;
+}
+
+void MG2639_GPRS::countUsage(int8_t channel, unsigned int payloadSent, unsigned int payloadReceived,
+                             unsigned int airSent, unsigned int airReceived)
+{
+	if ((channel >= 0) && (channel < USAGE_CHANNELS))
+		addUsage(_channelUsage[channel], payloadSent, payloadReceived, airSent, airReceived);
+	addUsage(_sessionUsage, payloadSent, payloadReceived, airSent, airReceived);
+	addUsage(_totalUsage, payloadSent, payloadReceived, airSent, airReceived);
+	
+	_unsavedBytes += airSent + airReceived;
+	if ((_usageStorage != NULL) && (_unsavedBytes >= USAGE_SAVE_INTERVAL))
+		saveUsage();
+}
+
+bool MG2639_GPRS::quotaAllows(unsigned int bytes)
+{
+	if (_hardQuota == 0)
+		return true;
+	
+	return _totalUsage.airSent + _totalUsage.airReceived + bytes <= _hardQuota;
+}
+
+bool MG2639_GPRS::connected()
+{
+	if (_dataMode)
+		return true;
+	
+	return _connected || (_rxRemaining > 0);
+}
+
+int MG2639_GPRS::enterDataMode(unsigned int packetTime, unsigned int packetSize)
+{
+	int iRetVal;
+	// 10 for command, '=' and ','s, 1 for channel, 1 for mode, 5 for time, 
+	// 4 for size
+	char transferCmd[26];
+	
+	if (_activeChannel < 0)
+		return ERROR_FAIL_RESPONSE;
+	if (_dataMode)
+		return SUCCESS_OK;
+	
+	// Send something like "AT+ZTRANSFER=0,2,200,536". Mode 2 is TCP.
+	memset(transferCmd, '\0', 26);
+	sprintf(transferCmd, "%s=%d,2,%u,%u", TRANSPARENT_SETUP, _activeChannel, 
+	        packetTime, packetSize);
+	_cell->sendATCommand((const char *)transferCmd);
+	// Should respond "+ZTRANSFER:0\r\n\r\nOK\r\n"
+	iRetVal = _cell->readWaitForResponses(RESPONSE_OK, RESPONSE_ERROR, COMMAND_RESPONSE_TIME);
+	if (iRetVal <= 0)
+		return iRetVal;
+	
+	_cell->sendATCommand(ENTER_DAT_MODE); // Send "ATO"
+	// Should respond "Enter into data mode, please input data:\r\nOK\r\n"
+	iRetVal = _cell->readWaitForResponses(RESPONSE_OK, RESPONSE_ERROR, COMMAND_RESPONSE_TIME);
+	if (iRetVal > 0)
+	{
+		_dataMode = true;
+		_packetTime = packetTime;
+		_packetSize = (packetSize > 0) ? packetSize : 1;
+		_packetFill = 0;
+	}
+	
+	return iRetVal;
+}
+
+int MG2639_GPRS::exitDataMode()
+{
+	int iRetVal;
+	
+	if (!_dataMode)
+		return SUCCESS_OK;
+	
+	// The escape sequence is only recognized if there's no other data
+	// around it. Wait out the guard time before and after "+++".
+	delay(DATA_MODE_GUARD_TIME);
+	_cell->clearSerial();
+	_cell->printString(ENTER_CMD_MODE); // "+++" (no "AT" or '\r')
+	// Should respond "Enter into cmd mode, please input AT command:"
+	iRetVal = _cell->readWaitForResponse(RESPONSE_CMD_MODE, DATA_MODE_GUARD_TIME * 2);
+	if (iRetVal <= 0)
+		return iRetVal;
+	
+	_dataMode = false;
+	
+	// Verify we really are in command mode:
+	return _cell->setEcho(0);
+}
+
 int8_t MG2639_GPRS::status()
 {
 	int iRetVal;
-	cell.sendATCommand(TCP_STATUS);
-	iRetVal = cell.readWaitForResponses("ESTABLISHED", "DISCONNECTED", WEB_RESPONSE_TIMEOUT);
+	_cell->sendATCommand(TCP_STATUS);
+	iRetVal = _cell->readWaitForResponses("ESTABLISHED", "DISCONNECTED", WEB_RESPONSE_TIMEOUT);
 	
 	if (iRetVal > 0)
 		return GPRS_ESTABLISHED;
@@ -166,23 +454,58 @@ int8_t MG2639_GPRS::status()
 
 int MG2639_GPRS::available()
 {
-	// Should check if we're connected & within a +ZIPRECV
-	return cell.dataAvailable();
+	int uartAvailable;
+	
+	// In data mode there's no framing, everything received is data.
+	if (_dataMode)
+		return _cell->dataAvailable();
+	
+	if (_rxRemaining == 0)
+		checkReceive();
+	if (_rxRemaining == 0)
+		return 0;
+	
+	uartAvailable = _cell->dataAvailable();
+	if ((unsigned int) uartAvailable > _rxRemaining)
+		return _rxRemaining;
+	
+	return uartAvailable;
 }
 
 int MG2639_GPRS::read()
 {
 	if (!available())
 		return -1;
-	return cell.uartRead();
+	
+	if (_dataMode) // No frames to count, so count bytes
+		countUsage(_activeChannel, 0, 1, 0, 1);
+	else
+		_rxRemaining--;
+	return _cell->uartRead();
 }
 
 int MG2639_GPRS::peek()
 {
+	if (!available())
+		return -1;
+	
+	return _cell->uartPeek();
 }
 
 void MG2639_GPRS::flush()
 {
+	unsigned long timeIn = millis();
+	
+	// The rest of the frame may still be on its way in from the module.
+	while (_rxRemaining && (timeIn + COMMAND_RESPONSE_TIME > millis()))
+	{
+		if (_cell->dataAvailable())
+		{
+			_cell->uartRead();
+			_rxRemaining--;
+		}
+	}
+	_rxRemaining = 0;
 }
 
 size_t MG2639_GPRS::write(uint8_t b)
@@ -193,21 +516,50 @@ size_t MG2639_GPRS::write(uint8_t b)
 size_t MG2639_GPRS::write(const uint8_t *buf, size_t size)
 {
 	int iRetVal;
+	
+	// In data mode, bytes go straight to the server. The module sends a
+	// packet every [packetSize] bytes, or once [packetTime] passes with no
+	// more data - charge a header for each packet this write() starts.
+	if (_dataMode)
+	{
+		if (millis() - _lastWrite >= _packetTime)
+			_packetFill = 0; // The module has sent the last partial packet
+		unsigned long total = (unsigned long)_packetFill + size;
+		unsigned int packets = (total + _packetSize - 1) / _packetSize -
+		                       (_packetFill + _packetSize - 1) / _packetSize;
+		
+		if (!quotaAllows(size + packets * USAGE_TCP_HEADER * 2))
+			return -1;
+		
+		_cell->printString((const char *)buf, size);
+		_lastWrite = millis();
+		_packetFill = total % _packetSize;
+		countUsage(_activeChannel, size, 0, size + packets * USAGE_TCP_HEADER,
+		           packets * USAGE_TCP_HEADER);
+		return size;
+	}
+	
+	if (!quotaAllows(size + USAGE_TCP_HEADER * 2))
+		return -1;
+	
 	// Maximum is 10 for command ',' and '=', 5 for port, 4 for length
 	char sendCmd[19];
 	memset(sendCmd, '\0', 19);
 	sprintf(sendCmd, "%s=%i,%i", TCP_SEND, _activeChannel, size);
-	cell.sendATCommand((const char *)sendCmd);
-	iRetVal = cell.readWaitForResponse(">", WEB_RESPONSE_TIMEOUT);
+	_cell->sendATCommand((const char *)sendCmd);
+	iRetVal = _cell->readWaitForResponse(">", WEB_RESPONSE_TIMEOUT);
 	if (iRetVal <= 0)
 		return -1;
 	
-	cell.clearSerial();		// Clear out the serial rx buffer
-	cell.printString((const char *)buf);	// Send the data string to cell module
-	iRetVal = cell.readWaitForResponse("+ZIPSEND: OK", WEB_RESPONSE_TIMEOUT);
+	_cell->clearSerial();		// Clear out the serial rx buffer
+	_cell->printString((const char *)buf, size);	// Send the data to cell module
+	iRetVal = _cell->readWaitForResponse("+ZIPSEND: OK", WEB_RESPONSE_TIMEOUT);
 	if (iRetVal <= 0)
 		return -1;
 	
+	// One packet out, and its ACK back
+	countUsage(_activeChannel, size, 0, size + USAGE_TCP_HEADER, USAGE_TCP_HEADER);
+	
 	return size;
 }
 
@@ -224,43 +576,35 @@ bool MG2639_GPRS::charToIPAddress(char * ipChar, IPAddress & ipRet)
 	return 0;
 }
 
-/*
-	//! Clean the rest of this function up 
-	uint8_t connection = 1;
-	int httpStatus = 0;
-	unsigned long timeIn = millis();
-	int received = 0;
+void MG2639_GPRS::checkReceive()
+{
+	int iRetVal;
+	long channel;
+	long length;
+	
+	if (!_cell->dataAvailable())
+		return;
 	
-	cell.clearBuffer();
-	while (connection && (timeIn + WEB_RESPONSE_TIMEOUT > millis()))
+	iRetVal = _cell->readWaitForResponses(TCP_RECEIVE, TCP_CLOSE, TCP_HEADER_TIMEOUT);
+	if (iRetVal == ERROR_FAIL_RESPONSE) // The server closed the link
 	{
-		if (cell.dataAvailable())
-		{
-			// !!! All of these strstr's (in this library in general) need to be
-			// replaced with a function that can search from the end of the 
-			// buffer back to the beginning.
-			// Fix the searchBuffer function below!
-			received += cell.readByteToBuffer();
-			// Check for the HTTP Status Response:
-			if ((httpStatus == 0) && (strstr((const char *)cell.rxBuffer, "200 OK")))
-			{
-				Serial.println("Received 200 OK");
-				httpStatus = 1;	// Received 200 OK
-			}
-			else if ((httpStatus == 0) && (strstr((const char *)cell.rxBuffer, "400 Bad Request")))
-			{
-				Serial.println("Received 400 Bad Request");
-				httpStatus = -1;	// Received 400 Bad Request
-			}
-			if (strstr((const char *)cell.rxBuffer, "+ZIPCLOSE"))
-			{
-				Serial.println("Closing the connection");
-				connection = 0;
-			}
-		}
+		_connected = false;
+		return;
 	}
+	if (iRetVal <= 0)
+		return;
 	
-	return received;
-*/
+	// Read the channel, then the length of the frame
+	channel = _cell->readNumber(',', TCP_HEADER_TIMEOUT);
+	if (channel < 0)
+		return;
+	length = _cell->readNumber(',', TCP_HEADER_TIMEOUT);
+	if (length > 0)
+	{
+		_rxRemaining = length;
+		// One packet in, and its ACK back
+		countUsage(channel, 0, length, USAGE_TCP_HEADER, length + USAGE_TCP_HEADER);
+	}
+}
 
 MG2639_GPRS gprs;
\ No newline at end of file
@@ -25,9 +25,61 @@ Distributed as-is; no warranty is given.
 
 #include <Stream.h>
 #include <IPAddress.h>
+#include "MG2639_Storage.h"
+
+// The module each class talks through - the global cell by default
+class MG2639_Cell;
+extern MG2639_Cell cell;
 
 #define DEFAULT_CHANNEL 0
 
+// Data usage accounting. On-air bytes are estimated: every +ZIPSEND or
+// +ZIPRECV frame is counted as one IPv4 packet, plus the ACK it causes in
+// the other direction. IP options, retransmissions and PPP's own traffic
+// (LCP echoes, etc.) aren't seen by the module, so aren't counted.
+// USAGE_CHANNELS - Number of TCP/UDP channels (0-4 on the MG2639) with their
+// own counters. Each takes 16 bytes of RAM. Traffic on higher channels, and
+// on MG2639_Server connections, is only counted in the session and total.
+#define USAGE_CHANNELS 5
+#define USAGE_TCP_HEADER 40 // IPv4 + TCP header, no options
+#define USAGE_UDP_HEADER 28 // IPv4 + UDP header
+// USAGE_SAVE_INTERVAL - On-air bytes counted before the totals are written
+// to storage again. Only changed bytes are written, so with EEPROM's 100,000
+// write cycles the busiest byte lasts for ~400 MB of traffic.
+#define USAGE_SAVE_INTERVAL 4096
+// USAGE_STORAGE_SIZE - Bytes setUsageStorage() uses, from address 0: two
+// 19-byte copies of the total, written in turn.
+#define USAGE_STORAGE_SIZE 38
+
+// gprs_usage - Data usage counters, in bytes. "payload" is the data passed to
+// write() or read(), "air" is the estimated total including headers.
+struct gprs_usage {
+	unsigned long payloadSent;
+	unsigned long payloadReceived;
+	unsigned long airSent;
+	unsigned long airReceived;
+};
+
+// quota_status - Values returned by quotaStatus():
+// 0: QUOTA_OK - Under the soft limit, or no quota set
+// 1: QUOTA_SOFT - Soft limit reached. Non-urgent sends should be deferred -
+//    MG2639_Queue::drain() leaves its records queued.
+// 2: QUOTA_HARD - Hard limit reached. connect() and sends are refused.
+enum quota_status {
+	QUOTA_OK = 0,
+	QUOTA_SOFT,
+	QUOTA_HARD
+};
+
+// Transparent (data) mode settings. In data mode the module collects bytes
+// into packets of up to DATA_MODE_PACKET_SIZE (536-1460) bytes, and sends a
+// partial packet after DATA_MODE_PACKET_TIME (50-65535) ms without new data.
+#define DATA_MODE_PACKET_TIME 200
+#define DATA_MODE_PACKET_SIZE 536
+// DATA_MODE_GUARD_TIME - Silence (ms) required before and after the "+++"
+// escape sequence that returns the module to command mode.
+#define DATA_MODE_GUARD_TIME 1000
+
 enum connection_status {
 	GPRS_DISCONNECTED = 0,
 	GPRS_ESTABLISHED
@@ -36,9 +88,13 @@ enum connection_status {
 class MG2639_GPRS : public Stream
 {
 public:
-	/// MG2639_GPRS() - Constructor
-	/// Sets up class variables
-	MG2639_GPRS();
+	/// MG2639_GPRS([modem]) - Constructor
+	/// Sets up class variables. Data goes through [modem] - the global cell
+	/// if it's left out.
+	MG2639_GPRS(MG2639_Cell & modem = cell);
+	
+	/// getCell() - Returns the modem data and commands go through.
+	inline MG2639_Cell & getCell() { return *_cell; };
 	
 	//////////////////////////////
 	// GPRS Connection Commands //
@@ -101,23 +157,117 @@ public:
 	/// Returns: >0 on success, <0 on fail
 	int connect(const char * domain, unsigned int port, uint8_t channel = DEFAULT_CHANNEL);
 	
-	/// available() - Returns number of characters available in the UART RX buffer.
+	/// stop() - Close the active TCP link. Sends AT+ZIPCLOSE. GPRS stays
+	/// open, so connect() can be called again right away.
+	///
+	/// Returns: >0 on success, <0 on fail
+	int stop();
+	
+	/// connected() - Returns true if the active TCP link is open, or if
+	/// there's received data left to read. No command is sent - a link
+	/// closed by the server is noticed when "+ZIPCLOSE" arrives, while
+	/// checking for data with available().
+	bool connected();
+	
+	///////////////////////////
+	// Data Usage Accounting //
+	///////////////////////////
+	
+	/// channelUsage([channel]) - Returns the usage of a TCP/UDP [channel]
+	/// since it was last connected.
+	gprs_usage channelUsage(uint8_t channel);
+	
+	/// sessionUsage() - Returns the usage since GPRS was last opened.
+	inline gprs_usage sessionUsage() { return _sessionUsage; };
+	
+	/// totalUsage() - Returns the usage since resetUsage(). With
+	/// setUsageStorage() this survives reboots - e.g. for a monthly plan.
+	inline gprs_usage totalUsage() { return _totalUsage; };
+	
+	/// resetUsage() - Clear the total (e.g. at the start of a billing
+	/// period), and save it if storage is set.
+	void resetUsage();
+	
+	/// setUsageStorage([storage]) - Keep the total in [storage]
+	/// (USAGE_STORAGE_SIZE, 38 bytes from address 0), so it survives
+	/// reboots. The saved total is loaded now, and saved again every
+	/// USAGE_SAVE_INTERVAL bytes, and by stop() and close().
+	///
+	/// Returns: >0 if a saved total was loaded, ERROR_FAIL_RESPONSE if
+	/// [storage] was blank or corrupt (the total starts from 0).
+	int setUsageStorage(MG2639_Storage & storage);
+	
+	/// saveUsage() - Write the total to storage now.
+	///
+	/// Returns: >0 on success, <0 if no storage is set.
+	int saveUsage();
+	
+	/// setQuota([soft], [hard]) - Limit the total on-air bytes (sent plus
+	/// received). Past [soft], quotaStatus() returns QUOTA_SOFT. Past
+	/// [hard], connect(), write() and UDP endPacket() fail with
+	/// ERROR_OVERRUN_PREVENT. 0 disables a limit.
+	void setQuota(unsigned long soft, unsigned long hard);
+	
+	/// quotaStatus() - Returns the current quota_status.
+	quota_status quotaStatus();
+	
+	///////////////////////////////////
+	// Transparent Data Mode Control //
+	///////////////////////////////////
+	
+	/// enterDataMode([packetTime], [packetSize]) - Switch the active TCP link
+	/// into transparent (data) mode. Sends AT+ZTRANSFER, then ATO.
+	/// In data mode write() and print() send bytes straight through to the
+	/// server - no "+ZIPSEND" command or acknowledgement per write - and
+	/// read() returns the server's data without "+ZIPRECV" framing.
+	/// No AT commands (SMS, phone, status, etc.) can be used until
+	/// exitDataMode() is called.
+	///
+	/// Sending bulk data through data mode is limited only by the UART. At
+	/// 9600 baud that's ~960 bytes/s. In command mode each write() is a
+	/// separate +ZIPSEND exchange - ~30 characters of command and response
+	/// plus a wait for the module to accept the data - so a stream of small
+	/// print()s spends most of its time waiting.
+	///
+	/// Returns: >0 on success, <0 on fail
+	int enterDataMode(unsigned int packetTime = DATA_MODE_PACKET_TIME,
+	                  unsigned int packetSize = DATA_MODE_PACKET_SIZE);
+	
+	/// exitDataMode() - Return to command mode by sending the "+++" escape
+	/// sequence, surrounded by DATA_MODE_GUARD_TIME of silence. The TCP link
+	/// stays open, enterDataMode() can be called again to resume.
+	///
+	/// Returns: >0 on success, <0 on fail
+	int exitDataMode();
+	
+	/// inDataMode() - Returns true if the module is in transparent mode.
+	inline bool inDataMode() { return _dataMode; };
+	
+	/// available() - Returns number of bytes of TCP data ready to read.
+	/// Data arrives from the module in "+ZIPRECV:<channel>,<length>,<data>"
+	/// frames. If there's no current frame, this function checks for a
+	/// new one, and strips the framing so only <data> is read.
+	/// In data mode there's no framing - everything in the UART RX buffer
+	/// is data.
     virtual int available();
 	
-	/// read() - Reads the first character out of the UART RX buffer. Then
-	/// removes it from the buffer.
+	/// read() - Reads a byte of TCP data, and removes it from the buffer.
+	///
+	/// Returns: The byte read, or -1 if no data is available.
     virtual int read();
 	
-	/// peek() - Looks at the first character in the UART RX buffer, but
-	/// the character is left at the top of the buffer.
-	//! TODO: not yet implemented
+	/// peek() - Looks at the next byte of TCP data, but leaves it in the
+	/// buffer.
+	///
+	/// Returns: The next byte, or -1 if no data is available.
     virtual int peek();
 	
-	//! TODO: not yet implemented
+	/// flush() - Discard the rest of the current "+ZIPRECV" frame.
     virtual void flush();
 	
 	/// write(b) - Send a single byte over a TCP link
 	/// This function sends the "AT+ZIPSEND" command, then the requested byte.
+	/// In data mode the byte is sent straight to the module.
 	/// +ZIPSEND requires a TCP channel number be sent along with the data.
 	/// This function uses the channel used in the last connect() function.
 	///
@@ -135,10 +285,58 @@ public:
 	using Print::write;
 	
 private:
+	// Module the data goes through
+	MG2639_Cell * _cell;
+	
 	// Keep track of the active channel - the last value specified in [channel]
 	// of connect([ip], [port], [channel])
 	int8_t _activeChannel; 
 	
+	// True while the module is in transparent (data) mode
+	bool _dataMode;
+	
+	// Data mode packetization, set by enterDataMode(). _packetFill is the
+	// number of bytes written toward the module's current packet.
+	unsigned int _packetTime;
+	unsigned int _packetSize;
+	unsigned int _packetFill;
+	unsigned long _lastWrite; // millis() of the last data mode write()
+	
+	// True from connect() until the link is closed
+	bool _connected;
+	
+	// Number of bytes of the current "+ZIPRECV" frame left to read
+	unsigned int _rxRemaining;
+	
+	/// checkReceive() - Check the UART for a new "+ZIPRECV" frame, or a
+	/// "+ZIPCLOSE" from the server.
+	void checkReceive();
+	
+	// Data usage counters and quota
+	gprs_usage _channelUsage[USAGE_CHANNELS];
+	gprs_usage _sessionUsage;
+	gprs_usage _totalUsage;
+	unsigned long _softQuota;
+	unsigned long _hardQuota;
+	unsigned long _unsavedBytes; // On-air bytes counted since the last save
+	uint8_t _usageSequence; // Sequence number of the last slot saved
+	MG2639_Storage * _usageStorage;
+	
+	// MG2639_UDP and MG2639_Server send and receive through the module
+	// directly, and report their traffic with countUsage().
+	friend class MG2639_UDP;
+	friend class MG2639_Server;
+	
+	/// countUsage([channel], [payloadSent], [payloadReceived], [airSent],
+	/// [airReceived]) - Add to the counters of [channel] (or only the
+	/// session and total, if [channel] < 0), and save the total if it's due.
+	void countUsage(int8_t channel, unsigned int payloadSent, unsigned int payloadReceived,
+	                unsigned int airSent, unsigned int airReceived);
+	
+	/// quotaAllows([bytes]) - Returns false if sending [bytes] more on-air
+	/// bytes would pass the hard quota.
+	bool quotaAllows(unsigned int bytes);
+	
 	// Helper function to convert a char array to IPAddress object
 	bool charToIPAddress(char * ipChar, IPAddress & ipRet);
 };
@@ -0,0 +1,458 @@
+/******************************************************************************
+MG2639_HTTP.cpp
+MG2639 Cellular Shield Library - HTTP Client Source
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines an HTTP/1.1 client that
+runs on top of MG2639_GPRS. Requests are sent through _gprs->write() and the
+response is parsed as it arrives, with bounded memory.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include "MG2639_HTTP.h"
+#include <SFE_MG2639_CellShield.h>
+
+// Size of the pieces readBody() passes to its callback
+#define HTTP_BODY_CHUNK 16
+
+MG2639_HTTP::MG2639_HTTP(MG2639_GPRS & modem)
+{
+	_gprs = &modem;
+	_host = NULL;
+	_port = 0;
+	_txLength = 0;
+	_txError = false;
+	_contentLength = -1;
+	_chunked = false;
+	_keepAlive = false;
+	_bodyDone = true;
+	_bodyRemaining = 0;
+	_chunkLineLength = 0;
+	_chunkTrailers = false;
+	_headerCallback = NULL;
+	setTimeout(HTTP_TIMEOUT);
+}
+
+int MG2639_HTTP::beginRequest(const char * host, unsigned int port,
+                              const char * method, const char * path)
+{
+	int iRetVal;
+	bool reuse;
+	
+	// available() picks up a "+ZIPCLOSE" the server may have sent while the
+	// link was idle.
+	_gprs->available();
+	reuse = _keepAlive && _bodyDone && (_host != NULL) &&
+	        (strcmp(_host, host) == 0) && (_port == port) && _gprs->connected();
+	if (!reuse)
+	{
+		if (_gprs->connected())
+			_gprs->stop();
+		iRetVal = _gprs->connect(host, port);
+		if (iRetVal < 0)
+			return iRetVal;
+	}
+	_host = host;
+	_port = port;
+	
+	_txLength = 0;
+	_txError = false;
+	print(method);
+	print(' ');
+	print(path);
+	print(F(" HTTP/1.1\r\n"));
+	sendHeader("Host", host);
+	
+	return SUCCESS_OK;
+}
+
+void MG2639_HTTP::sendHeader(const char * name, const char * value)
+{
+	print(name);
+	print(F(": "));
+	print(value);
+	print(F("\r\n"));
+}
+
+void MG2639_HTTP::sendHeader(const char * name, long value)
+{
+	print(name);
+	print(F(": "));
+	print(value);
+	print(F("\r\n"));
+}
+
+int MG2639_HTTP::endRequest()
+{
+	print(F("\r\n"));
+	flush();
+	
+	return _txError ? ERROR_FAIL_RESPONSE : SUCCESS_OK;
+}
+
+int MG2639_HTTP::get(const char * host, const char * path, unsigned int port)
+{
+	int iRetVal;
+	
+	iRetVal = beginRequest(host, port, "GET", path);
+	if (iRetVal < 0)
+		return iRetVal;
+	
+	return endRequest();
+}
+
+int MG2639_HTTP::post(const char * host, const char * path, const char * contentType,
+                      const uint8_t * body, unsigned int length, unsigned int port)
+{
+	int iRetVal;
+	
+	iRetVal = beginRequest(host, port, "POST", path);
+	if (iRetVal < 0)
+		return iRetVal;
+	
+	sendHeader("Content-Type", contentType);
+	sendHeader("Content-Length", (long) length);
+	// Don't flush between the headers and the body - a small request goes
+	// out in a single +ZIPSEND.
+	print(F("\r\n"));
+	write(body, length);
+	flush();
+	
+	return _txError ? ERROR_FAIL_RESPONSE : SUCCESS_OK;
+}
+
+int MG2639_HTTP::responseStatus()
+{
+	char line[HTTP_LINE_SIZE];
+	int length;
+	int status;
+	
+	_contentLength = -1;
+	_chunked = false;
+	_keepAlive = true;
+	_bodyDone = false;
+	_bodyRemaining = 0;
+	_chunkLineLength = 0;
+	_chunkTrailers = false;
+	
+	// Status line looks like "HTTP/1.1 200 OK". Skip any "100 Continue"
+	// responses, they're followed by the real one.
+	do
+	{
+		do
+		{
+			length = readLine(line, sizeof(line));
+		} while (length == 0);
+		if (length < 0)
+			return ERROR_TIMEOUT;
+		if ((strncmp(line, "HTTP/1.", 7) != 0) || (line[8] != ' '))
+			return ERROR_UNKNOWN_RESPONSE;
+		status = atoi(line + 9);
+		if (line[7] == '0') // HTTP/1.0 closes the link by default
+			_keepAlive = false;
+	
+		// Headers, up to a blank line
+		while ((length = readLine(line, sizeof(line))) > 0)
+		{
+			if (strncasecmp(line, "Content-Length:", 15) == 0)
+			{
+				_contentLength = atol(line + 15);
+			}
+			else if (strncasecmp(line, "Transfer-Encoding:", 18) == 0)
+			{
+				char * value = line + 18;
+				while (*value == ' ')
+					value++;
+				if (strncasecmp(value, "chunked", 7) == 0)
+					_chunked = true;
+			}
+			else if (strncasecmp(line, "Connection:", 11) == 0)
+			{
+				char * value = line + 11;
+				while (*value == ' ')
+					value++;
+				if (strncasecmp(value, "close", 5) == 0)
+					_keepAlive = false;
+			}
+			if (_headerCallback != NULL)
+				_headerCallback(line);
+		}
+		if (length < 0)
+			return ERROR_TIMEOUT;
+	} while ((status >= 100) && (status < 200));
+	
+	if (_chunked)
+	{
+		_contentLength = -1; // Chunk sizes are read as the body is
+	}
+	else if ((status == 204) || (status == 304))
+	{
+		_bodyDone = true; // No body
+	}
+	else if (_contentLength >= 0)
+	{
+		_bodyRemaining = _contentLength;
+		if (_bodyRemaining == 0)
+			_bodyDone = true;
+	}
+	else
+	{
+		// No length - the body runs until the server closes the link.
+		_keepAlive = false;
+	}
+	
+	return status;
+}
+
+long MG2639_HTTP::readBody(http_body_fn fn)
+{
+	uint8_t buffer[HTTP_BODY_CHUNK];
+	long total = 0;
+	unsigned long timeIn = millis();
+	
+	while (!_bodyDone)
+	{
+		unsigned int length = 0;
+		while ((length < HTTP_BODY_CHUNK) && (available() > 0))
+			buffer[length++] = read();
+	
+		if (length > 0)
+		{
+			if (fn != NULL)
+				fn(buffer, length);
+			total += length;
+			timeIn = millis();
+		}
+		else if (!connected())
+		{
+			break;
+		}
+		else if (timeIn + _timeout < millis())
+		{
+			return ERROR_TIMEOUT;
+		}
+	}
+	
+	return total;
+}
+
+int MG2639_HTTP::skipBody()
+{
+	long iRetVal = readBody(NULL);
+	
+	if (iRetVal < 0)
+		return iRetVal;
+	
+	return SUCCESS_OK;
+}
+
+bool MG2639_HTTP::connected()
+{
+	if (!_bodyDone)
+		available(); // Checks for the end of the body
+	if (_bodyDone)
+		return false;
+	
+	// The rest of the body can't come if the link has dropped
+	if (!_gprs->connected() && (_gprs->available() == 0))
+	{
+		_keepAlive = false;
+		return false;
+	}
+	
+	return true;
+}
+
+void MG2639_HTTP::stop()
+{
+	_gprs->stop();
+	_bodyDone = true;
+	_keepAlive = false;
+}
+
+int MG2639_HTTP::available()
+{
+	int gprsAvailable;
+	
+	if (_bodyDone)
+		return 0;
+	
+	if (_chunked && (_bodyRemaining == 0))
+	{
+		if (!nextChunk())
+			return 0;
+	}
+	
+	gprsAvailable = _gprs->available();
+	if (gprsAvailable == 0)
+	{
+		// A body without a length ends when the link closes.
+		if (!_chunked && (_contentLength < 0) && !_gprs->connected())
+			_bodyDone = true;
+		return 0;
+	}
+	
+	if ((_chunked || (_contentLength >= 0)) &&
+	    ((unsigned long) gprsAvailable > _bodyRemaining))
+		return _bodyRemaining;
+	
+	return gprsAvailable;
+}
+
+int MG2639_HTTP::read()
+{
+	if (!available())
+		return -1;
+	
+	bodyByte();
+	return _gprs->read();
+}
+
+int MG2639_HTTP::peek()
+{
+	if (!available())
+		return -1;
+	
+	return _gprs->peek();
+}
+
+void MG2639_HTTP::flush()
+{
+	if (_txLength == 0)
+		return;
+	
+	if (_gprs->write(_txBuffer, _txLength) != _txLength)
+		_txError = true;
+	_txLength = 0;
+}
+
+size_t MG2639_HTTP::write(uint8_t b)
+{
+	_txBuffer[_txLength++] = b;
+	if (_txLength >= HTTP_TX_BUFFER_SIZE)
+		flush();
+	
+	return _txError ? 0 : 1;
+}
+
+int MG2639_HTTP::gprsRead()
+{
+	unsigned long timeIn = millis();
+	
+	while (timeIn + _timeout > millis())
+	{
+		if (_gprs->available())
+			return _gprs->read();
+		if (!_gprs->connected())
+			break;
+	}
+	
+	return ERROR_TIMEOUT;
+}
+
+int MG2639_HTTP::readLine(char * line, unsigned int size)
+{
+	unsigned int length = 0;
+	int c;
+	
+	while ((c = gprsRead()) >= 0)
+	{
+		if (c == '\n')
+		{
+			line[(length < size) ? length : size - 1] = '\0';
+			return length;
+		}
+		if (c == '\r')
+			continue;
+		if (length < size - 1)
+			line[length] = c;
+		length++;
+	}
+	
+	return ERROR_TIMEOUT;
+}
+
+bool MG2639_HTTP::chunkLineReady()
+{
+	while (_gprs->available())
+	{
+		char c = _gprs->read();
+		if (c == '\n')
+		{
+			_chunkLine[(_chunkLineLength < sizeof(_chunkLine)) ?
+			           _chunkLineLength : sizeof(_chunkLine) - 1] = '\0';
+			return true;
+		}
+		if (c == '\r')
+			continue;
+		if (_chunkLineLength < sizeof(_chunkLine) - 1)
+			_chunkLine[_chunkLineLength] = c;
+		if (_chunkLineLength < 255)
+			_chunkLineLength++;
+	}
+	
+	return false;
+}
+
+bool MG2639_HTTP::nextChunk()
+{
+	while (chunkLineReady())
+	{
+		uint8_t length = _chunkLineLength;
+		_chunkLineLength = 0;
+		
+		if (_chunkTrailers)
+		{
+			// Skip any trailer headers, up to the blank line
+			if (length == 0)
+			{
+				_bodyDone = true;
+				return false;
+			}
+			continue;
+		}
+		
+		// The "\r\n" after the previous chunk reads as a blank line
+		if (length == 0)
+			continue;
+		
+		_bodyRemaining = strtoul(_chunkLine, NULL, 16);
+		if (_bodyRemaining > 0)
+			return true;
+		_chunkTrailers = true; // Last chunk
+	}
+	
+	// Not a whole line yet. If the link has gone, it never will be.
+	if (!_gprs->connected())
+	{
+		_bodyDone = true;
+		_keepAlive = false;
+	}
+	
+	return false;
+}
+
+void MG2639_HTTP::bodyByte()
+{
+	if (_chunked)
+	{
+		_bodyRemaining--;
+	}
+	else if (_contentLength >= 0)
+	{
+		if (--_bodyRemaining == 0)
+			_bodyDone = true;
+	}
+}
+
+MG2639_HTTP cellHTTP;
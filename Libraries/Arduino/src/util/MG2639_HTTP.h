@@ -0,0 +1,230 @@
+/******************************************************************************
+MG2639_HTTP.h
+MG2639 Cellular Shield Library - HTTP Client Header
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines an HTTP/1.1 client that
+runs on top of MG2639_GPRS. MG2639_HTTP builds requests in a small buffer and
+sends them through gprs.write(), then parses the response as it arrives - the
+status line and headers one line at a time, then the body, a few bytes at a
+time. Nothing is ever held in RAM whole, so responses of any size can be read.
+
+Content-Length and chunked bodies are supported. The TCP link is kept open
+between requests to the same host (keep-alive), unless the server asks to
+close it.
+
+e.g.:	cellHTTP.get("example.com", "/data.txt");
+		if (cellHTTP.responseStatus() == 200)
+			while (cellHTTP.connected()) // Stream the body
+				if (cellHTTP.available())
+					Serial.write(cellHTTP.read());
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#ifndef _MG2639_HTTP_H_
+#define _MG2639_HTTP_H_
+
+#include <Stream.h>
+#include "MG2639_GPRS.h"
+
+// HTTP_TX_BUFFER_SIZE - Request bytes are collected in a buffer of this size
+// and sent with one +ZIPSEND when it fills (or the request ends).
+#define HTTP_TX_BUFFER_SIZE 64
+
+// HTTP_LINE_SIZE - Longest status or header line that's read in full. Longer
+// lines are cut short - that only matters for headers you want to look at.
+// The line buffer is on the stack, and only while headers are being read.
+#define HTTP_LINE_SIZE 48
+
+// HTTP_TIMEOUT - Default time (ms) to wait for the response to start, or for
+// more of it to arrive. Change it with setTimeout().
+#define HTTP_TIMEOUT 30000
+
+/// http_body_fn - Called by readBody() with each piece of the response body.
+typedef void (*http_body_fn)(const uint8_t * data, unsigned int length);
+
+class MG2639_HTTP : public Stream
+{
+public:
+	/// MG2639_HTTP([modem]) - Constructor
+	/// Sets up class variables. Requests go through [modem] - the global gprs
+	/// if it's left out.
+	MG2639_HTTP(MG2639_GPRS & modem = gprs);
+	
+	//////////////////////
+	// Sending Requests //
+	//////////////////////
+	
+	/// beginRequest([host], [port], [method], [path]) - Start a request,
+	/// e.g. beginRequest("example.com", 80, "GET", "/").
+	/// If the last request went to the same [host] and [port] and the link
+	/// is still open, it's re-used. Otherwise a new TCP link is set up with
+	/// gprs.connect(). gprs.open() must be called first.
+	/// The request line and Host header are sent. Add more headers with
+	/// sendHeader(), then call endRequest().
+	/// [host] must stay valid until the next beginRequest().
+	///
+	/// Returns: >0 on success, <0 on fail
+	int beginRequest(const char * host, unsigned int port, const char * method,
+	                 const char * path);
+	
+	/// sendHeader([name], [value]) - Add a header to the request.
+	void sendHeader(const char * name, const char * value);
+	void sendHeader(const char * name, long value);
+	
+	/// endRequest() - Finish the headers and send the request. If the
+	/// request has a body, send a Content-Length header first, then call
+	/// endRequest(), then print() or write() the body, then flush().
+	///
+	/// Returns: >0 on success, <0 on fail
+	int endRequest();
+	
+	/// get([host], [path], [port]) - Send a GET request.
+	///
+	/// Returns: >0 on success, <0 on fail
+	int get(const char * host, const char * path, unsigned int port = 80);
+	
+	/// post([host], [path], [contentType], [body], [length], [port]) - Send
+	/// a POST request with a [length] byte [body].
+	///
+	/// Returns: >0 on success, <0 on fail
+	int post(const char * host, const char * path, const char * contentType,
+	         const uint8_t * body, unsigned int length, unsigned int port = 80);
+	
+	//////////////////////////
+	// Reading the Response //
+	//////////////////////////
+	
+	/// responseStatus() - Wait for the response, and read the status line
+	/// and headers. The body is left to be read with read(), readBody(),
+	/// or skipped with skipBody().
+	///
+	/// Returns: HTTP status code (e.g. 200), or <0 on fail (ERROR_TIMEOUT if
+	/// nothing arrived, ERROR_UNKNOWN_RESPONSE if it wasn't HTTP).
+	int responseStatus();
+	
+	/// contentLength() - Returns the Content-Length of the response, or -1
+	/// if the server didn't send one (chunked, or until the link closes).
+	inline long contentLength() { return _contentLength; };
+	
+	/// isChunked() - Returns true if the body uses chunked encoding.
+	inline bool isChunked() { return _chunked; };
+	
+	/// keepAlive() - Returns true if the link can be re-used for the next
+	/// request.
+	inline bool keepAlive() { return _keepAlive; };
+	
+	/// setHeaderCallback([fn]) - [fn] is called with each response header
+	/// line ("Name: value", cut to HTTP_LINE_SIZE - 1 characters).
+	inline void setHeaderCallback(void (*fn)(const char * line)) { _headerCallback = fn; };
+	
+	/// readBody([fn]) - Read the whole body, passing it to [fn] a few bytes
+	/// at a time.
+	///
+	/// Returns: Number of body bytes read, or <0 if it timed out first.
+	long readBody(http_body_fn fn);
+	
+	/// skipBody() - Read and discard the rest of the body, so the link can
+	/// be used for the next request.
+	///
+	/// Returns: >0 on success, <0 on fail
+	int skipBody();
+	
+	/// connected() - Returns true until the whole body has been read, or
+	/// the link drops with nothing left to read.
+	bool connected();
+	
+	/// stop() - Close the TCP link.
+	void stop();
+	
+	///////////////////////////
+	// Stream Data Interface //
+	///////////////////////////
+	
+	/// available() - Returns number of body bytes ready to read. Doesn't
+	/// wait - a chunk size line is only read once all of it has arrived.
+	virtual int available();
+	
+	/// read() - Read a byte of the body. Chunk headers are removed.
+	///
+	/// Returns: The byte read, or -1 if no data is available.
+	virtual int read();
+	
+	/// peek() - Look at the next byte of the body.
+	///
+	/// Returns: The next byte, or -1 if no data is available.
+	virtual int peek();
+	
+	/// flush() - Send anything left in the request buffer. Call this after
+	/// writing a request body.
+	virtual void flush();
+	
+	/// write(b) - Add a byte to the request.
+	///
+	/// Returns: 1, or 0 if the request buffer couldn't be sent.
+	virtual size_t write(uint8_t b);
+	
+	using Print::write;
+
+private:
+	MG2639_GPRS * _gprs;
+	const char * _host;
+	unsigned int _port;
+	
+	// Request being built
+	uint8_t _txBuffer[HTTP_TX_BUFFER_SIZE];
+	uint8_t _txLength;
+	bool _txError;
+	
+	// Response state
+	long _contentLength;
+	bool _chunked;
+	bool _keepAlive;
+	bool _bodyDone; // Set once the whole body has been read
+	unsigned long _bodyRemaining; // Bytes left in the body, or current chunk
+	
+	// Chunk size line, collected as it arrives so available() never waits.
+	// Hex size, maybe followed by ";extensions".
+	char _chunkLine[12];
+	uint8_t _chunkLineLength;
+	bool _chunkTrailers; // Past the last chunk, skipping trailer headers
+	
+	void (*_headerCallback)(const char * line);
+	
+	/// gprsRead() - Read a byte from gprs, waiting up to the timeout.
+	/// Returns: The byte, or -1 if it timed out.
+	int gprsRead();
+	
+	/// readLine([line], [size]) - Read a line, up to "\r\n", into [line]. The
+	/// line is cut to [size] - 1 characters, the rest is skipped.
+	/// Returns: Length of the line (before cutting), or <0 on timeout.
+	int readLine(char * line, unsigned int size);
+	
+	/// chunkLineReady() - Add the bytes already received to _chunkLine,
+	/// without waiting for more.
+	/// Returns: true once a whole line is in _chunkLine.
+	bool chunkLineReady();
+	
+	/// nextChunk() - Read a chunk size line, if it's all arrived. Sets
+	/// _bodyRemaining, or _bodyDone if it's the last chunk (or the link
+	/// dropped).
+	/// Returns: true if there's another chunk to read.
+	bool nextChunk();
+	
+	/// bodyByte() - Count a body byte read from gprs.
+	void bodyByte();
+};
+
+extern MG2639_HTTP cellHTTP;
+
+#endif
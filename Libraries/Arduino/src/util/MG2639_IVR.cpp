@@ -0,0 +1,134 @@
+/******************************************************************************
+MG2639_IVR.cpp
+MG2639 Cellular Shield Library - In-Call IVR Menu Source
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines a DTMF menu engine for
+voice calls. MG2639_IVR walks a PROGMEM menu tree, driven by
+_phone->readDTMF().
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include "MG2639_IVR.h"
+#include <SFE_MG2639_CellShield.h>
+
+MG2639_IVR::MG2639_IVR(const ivr_node * nodes, uint8_t count, ivr_prompt_fn prompt,
+                       ivr_code_fn code, MG2639_Phone & modem)
+{
+	_phone = &modem;
+	_nodes = nodes;
+	_count = count;
+	_promptFn = prompt;
+	_codeFn = code;
+	_node = IVR_END;
+	_length = 0;
+	_timeouts = 0;
+	_lastKey = 0;
+	_code[0] = '\0';
+}
+
+void MG2639_IVR::start()
+{
+	_timeouts = 0;
+	enter(0);
+}
+
+uint8_t MG2639_IVR::update()
+{
+	ivr_node node;
+	int key;
+	
+	while ((_node != IVR_END) && ((key = _phone->readDTMF()) >= 0))
+		press(key);
+	
+	if (!load(_node, &node))
+		return _node;
+	if (millis() - _lastKey >= node.timeout)
+	{
+		if (++_timeouts >= IVR_MAX_TIMEOUTS)
+			enter(IVR_END);
+		else
+			enter(node.expire);
+	}
+	
+	return _node;
+}
+
+uint8_t MG2639_IVR::press(char key)
+{
+	ivr_node node;
+	const char * ptr;
+	
+	if (!load(_node, &node))
+		return _node;
+	_timeouts = 0;
+	_lastKey = millis();
+	
+	if (node.keys[0] != '\0')
+	{
+		// Menu - a key it doesn't offer plays the prompt again
+		ptr = strchr(node.keys, key);
+		enter((ptr != NULL) ? node.next[ptr - node.keys] : _node);
+		return _node;
+	}
+	
+	// Code
+	if (key == '*')
+	{
+		_length = 0;
+	}
+	else if (key != '#')
+	{
+		if (_length < IVR_CODE_SIZE - 1)
+			_code[_length++] = key;
+	}
+	_code[_length] = '\0';
+	if ((_length >= node.length) || ((key == '#') && (_length > 0)))
+	{
+		bool accepted = (_codeFn != NULL) && _codeFn(_node, _code);
+		enter(node.next[accepted ? 0 : 1]);
+	}
+	
+	return _node;
+}
+
+void MG2639_IVR::enter(uint8_t node)
+{
+	ivr_node next;
+	
+	// Steps go straight on. Stop after _count, in case they loop.
+	for (uint8_t steps = 0; steps <= _count; steps++)
+	{
+		if (node >= _count)
+			node = IVR_END;
+		_node = node;
+		_length = 0;
+		_code[0] = '\0';
+		_lastKey = millis();
+		if (_promptFn != NULL)
+			_promptFn(node);
+		if (!load(node, &next) || (next.keys[0] != '\0') || (next.length > 0))
+			return;
+		node = next.next[0];
+	}
+	_node = IVR_END;
+}
+
+bool MG2639_IVR::load(uint8_t node, ivr_node * dest)
+{
+	if (node >= _count)
+		return false;
+	
+	memcpy_P(dest, &_nodes[node], sizeof(ivr_node));
+	return true;
+}
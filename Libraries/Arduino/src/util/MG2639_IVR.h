@@ -0,0 +1,150 @@
+/******************************************************************************
+MG2639_IVR.h
+MG2639 Cellular Shield Library - In-Call IVR Menu Header
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines a DTMF menu engine for
+voice calls. MG2639_IVR walks a menu tree kept in PROGMEM, one node at a
+time, driven by the digits the caller presses (phone.readDTMF()).
+
+e.g.:	enum {MENU, PIN, OPEN, STATUS};
+		const ivr_node menu[] PROGMEM = {
+			// keys,  next,             length, expire, timeout (ms)
+			{"12",    {PIN, STATUS},    0,      MENU,   8000},	// MENU
+			{"",      {OPEN, MENU},     4,      MENU,   10000},	// PIN
+			{"",      {IVR_END},        0,      0,      0},		// OPEN
+			{"",      {MENU},           0,      0,      0}		// STATUS
+		};
+		MG2639_IVR ivr(menu, 4, playPrompt, checkPin);
+		// Once a call is answered: ivr.start(). Then, in loop():
+		phone.poll(onCallEvent);
+		if (ivr.update() == IVR_END)
+			phone.hangUp();
+
+Each node is one of three kinds:
+- A menu ([keys] isn't empty): each key leads to the node in the same place
+  in [next]. Another key plays the node's prompt again.
+- A code ([keys] is empty, [length] isn't): up to [length] digits are
+  collected, then passed to the code callback - [next][0] if it accepts
+  them, [next][1] if not. '#' sends a shorter code, '*' starts it again.
+- A step (both empty): goes straight on to [next][0] once its prompt has
+  been played - use it for actions, like OPEN above.
+
+Every node's prompt callback is called as it's entered - play a tone, or
+do the node's action. A node with no key within [timeout] (ms, restarted by
+each digit) goes to [expire]. IVR_MAX_TIMEOUTS in a row end the menu.
+Digits pressed during a prompt wait in phone's DTMF buffer, so callers who
+know the menu can type ahead.
+
+Receiving digits during a call is UNVERIFIED - the MG2639 AT manuals don't
+document a DTMF detection report, so phone.readDTMF() may never return one
+(see MG2639_Phone.h). press() drives the menu from any other source of
+digits, such as an external DTMF decoder on the audio output.
+
+Memory is fixed: 16 bytes of RAM, plus the code buffer (IVR_CODE_SIZE).
+Each node takes 17 bytes of flash (IVR_MAX_KEYS 6).
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#ifndef _MG2639_IVR_H_
+#define _MG2639_IVR_H_
+
+#include <Arduino.h>
+#include "MG2639_Phone.h"
+
+// IVR_MAX_KEYS - Most keys a menu node can offer (2 or more).
+#define IVR_MAX_KEYS 6
+
+// IVR_CODE_SIZE - Longest code a node can collect, plus its 0-terminator.
+#define IVR_CODE_SIZE 9
+
+// IVR_MAX_TIMEOUTS - Timeouts in a row before the menu ends.
+#define IVR_MAX_TIMEOUTS 3
+
+// IVR_END - Node number that ends the menu (e.g. to hang up).
+#define IVR_END 0xFF
+
+/// ivr_node - One node of a menu tree, stored in PROGMEM.
+struct ivr_node {
+	char keys[IVR_MAX_KEYS + 1]; // Menu keys, e.g. "12#", or "" for a code or step
+	uint8_t next[IVR_MAX_KEYS]; // Node each key leads to
+	uint8_t length; // Digits in a code
+	uint8_t expire; // Node to go to on timeout
+	uint16_t timeout; // Time (ms) to wait for a digit
+};
+
+/// ivr_prompt_fn - Called with each node as it's entered, and with IVR_END
+/// when the menu ends (e.g. to say goodbye).
+typedef void (*ivr_prompt_fn)(uint8_t node);
+
+/// ivr_code_fn - Called with the digits collected by a code node.
+/// Returns: true to accept them.
+typedef bool (*ivr_code_fn)(uint8_t node, const char * code);
+
+class MG2639_IVR
+{
+public:
+	/// MG2639_IVR([nodes], [count], [prompt], [code]) - Constructor
+	/// [nodes] is a table of [count] nodes in PROGMEM - node 0 is the first.
+	/// [prompt] is called as each node is entered, [code] with each code
+	/// collected (NULL rejects every code). Digits are read from [modem] -
+	/// the global phone if it's left out.
+	MG2639_IVR(const ivr_node * nodes, uint8_t count, ivr_prompt_fn prompt,
+	           ivr_code_fn code = NULL, MG2639_Phone & modem = phone);
+	
+	/// start() - Enter node 0. Call it once a call is answered.
+	void start();
+	
+	/// stop() - End the menu, e.g. when the call ends.
+	inline void stop() { _node = IVR_END; };
+	
+	/// update() - Take the digits waiting in phone.readDTMF() and check the
+	/// node's timeout. Call it in loop(), after phone.poll().
+	///
+	/// Returns: The current node, or IVR_END once the menu has ended.
+	uint8_t update();
+	
+	/// press([key]) - Take one digit, as update() does with each from
+	/// phone.readDTMF() - e.g. to drive the menu from elsewhere, or test it.
+	///
+	/// Returns: The current node, or IVR_END.
+	uint8_t press(char key);
+	
+	/// getNode() - Returns the current node, or IVR_END.
+	inline uint8_t getNode() { return _node; };
+	
+	/// getCode() - Returns the digits collected so far by a code node.
+	inline const char * getCode() { return _code; };
+
+private:
+	MG2639_Phone * _phone;
+	const ivr_node * _nodes;
+	uint8_t _count;
+	ivr_prompt_fn _promptFn;
+	ivr_code_fn _codeFn;
+	uint8_t _node;
+	uint8_t _length; // Digits in _code
+	uint8_t _timeouts; // Timeouts in a row
+	unsigned long _lastKey; // Time the node was entered, or of the last digit
+	char _code[IVR_CODE_SIZE];
+	
+	/// enter([node]) - Move to [node] and play its prompt, passing through
+	/// any steps.
+	void enter(uint8_t node);
+	
+	/// load([node], [dest]) - Copy [node] from PROGMEM.
+	/// Returns: false if [node] is out of range.
+	bool load(uint8_t node, ivr_node * dest);
+};
+
+#endif
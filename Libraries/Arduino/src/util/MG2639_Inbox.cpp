@@ -0,0 +1,255 @@
+/******************************************************************************
+MG2639_Inbox.cpp
+MG2639 Cellular Shield Library - SMS Inbox Cache Source
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines an SMS inbox cache.
+MG2639_Inbox, a friend class of MG2639_Cell, builds a table of the SIM's
+messages from a single AT+CMGL.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include "MG2639_Inbox.h"
+#include "MG2639_AT.h"
+#include <SFE_MG2639_CellShield.h>
+
+// Longest status ("REC UNREAD", "STO UNSENT") or date field kept
+#define INBOX_FIELD_SIZE 24
+
+MG2639_Inbox::MG2639_Inbox(MG2639_SMS & modem)
+{
+	_sms = &modem;
+	_count = 0;
+	_listed = 0;
+	_pending = 0;
+	_refreshTime = 0;
+}
+
+int MG2639_Inbox::refresh(sms_status status, inbox_body_fn fn)
+{
+	int iRetVal;
+	char tempCmd[21];
+	char field[INBOX_FIELD_SIZE];
+	unsigned long timeIn = millis();
+
+	memset(tempCmd, 0, 21);
+	switch (status)
+	{
+	case REC_UNREAD:
+		sprintf(tempCmd, "%s=\"REC UNREAD\"", SMS_LIST);
+		break;
+	case REC_READ:
+		sprintf(tempCmd, "%s=\"REC READ\"", SMS_LIST);
+		break;
+	case REC_ALL:
+		sprintf(tempCmd, "%s=\"ALL\"", SMS_LIST);
+		break;
+	default:
+		return ERROR_FAIL_RESPONSE;
+	}
+
+	_count = 0;
+	_listed = 0;
+	_pending = 0;
+	// Throw away anything left over (e.g. the "OK" after an sms.read()), so
+	// it isn't taken for the end of the list.
+	_sms->getCell().clearSerial();
+	_sms->getCell().clearBuffer();
+	_sms->getCell().sendATCommand((const char *)tempCmd);
+
+	// Each message looks like:
+	// +CMGL: 3,"REC UNREAD","1xxxnnnzzzz","","2014/10/12 21:54:25-24"\r\n
+	// Hey hey hey\r\n
+	// and the list ends with "OK". Bodies are read here, so text in them
+	// can't be mistaken for the next header.
+	iRetVal = _sms->getCell().readWaitForResponses("+CMGL: ", RESPONSE_OK,
+	                                               INBOX_LIST_TIMEOUT);
+	while (iRetVal > 0)
+	{
+		inbox_entry * entry = NULL;
+		int8_t slot = -1;
+		char chunk[INBOX_CHUNK_SIZE];
+		uint8_t chunkLength = 0;
+		uint16_t hash = 0xFFFF;
+		unsigned int length = 0;
+		long index;
+		int c;
+
+		index = _sms->getCell().readNumber(',', COMMAND_RESPONSE_TIME);
+		if (index < 0)
+			return index;
+		_listed++;
+		if (_count < INBOX_SIZE)
+		{
+			slot = _count;
+			entry = &_entries[slot];
+			entry->index = index;
+		}
+
+		// Status, sender, (empty) name, date
+		if (_sms->getCell().readQuoted(field, sizeof(field), COMMAND_RESPONSE_TIME) < 0)
+			return ERROR_TIMEOUT;
+		if (entry != NULL)
+		{
+			if (strcmp(field, "REC UNREAD") == 0)
+				entry->status = REC_UNREAD;
+			else if (strcmp(field, "REC READ") == 0)
+				entry->status = REC_READ;
+			else
+				entry->status = REC_ALL;
+		}
+		if (_sms->getCell().readQuoted(entry != NULL ? entry->sender : field,
+		                    entry != NULL ? MAX_PHONE_NUMBER_SIZE : sizeof(field),
+		                    COMMAND_RESPONSE_TIME) < 0)
+			return ERROR_TIMEOUT;
+		if ((_sms->getCell().readQuoted(field, sizeof(field),
+		    COMMAND_RESPONSE_TIME) < 0) ||
+		    (_sms->getCell().readQuoted(field, sizeof(field), COMMAND_RESPONSE_TIME) < 0))
+			return ERROR_TIMEOUT;
+		if (entry != NULL)
+			entry->timestamp = packDate(field);
+
+		// Rest of the header line
+		while ((c = _sms->getCell().readChar(COMMAND_RESPONSE_TIME)) != '\n')
+		{
+			if (c < 0)
+				return ERROR_TIMEOUT;
+		}
+
+		// Body, up to "\r\n"
+		while ((c = _sms->getCell().readChar(COMMAND_RESPONSE_TIME)) != '\r')
+		{
+			if (c < 0)
+				return ERROR_TIMEOUT;
+			hash = crc16(hash, c);
+			length++;
+			if (fn != NULL)
+			{
+				chunk[chunkLength++] = c;
+				if (chunkLength == INBOX_CHUNK_SIZE)
+				{
+					fn(slot, chunk, chunkLength);
+					chunkLength = 0;
+				}
+			}
+		}
+		if ((fn != NULL) && (chunkLength > 0))
+			fn(slot, chunk, chunkLength);
+
+		if (entry != NULL)
+		{
+			entry->length = (length > 255) ? 255 : length;
+			entry->hash = hash;
+			_pending |= 1UL << slot;
+			_count++;
+		}
+
+		iRetVal = _sms->getCell().readWaitForResponses("+CMGL: ", RESPONSE_OK,
+		                                               COMMAND_RESPONSE_TIME);
+	}
+	_refreshTime = millis() - timeIn;
+
+	// Reading "OK" is the end of the list
+	if (iRetVal != ERROR_FAIL_RESPONSE)
+		return iRetVal;
+
+	return _listed;
+}
+
+int MG2639_Inbox::next()
+{
+	int slot;
+
+	if (_pending == 0)
+		return -1;
+
+	slot = __builtin_ffsl(_pending) - 1;
+	_pending &= ~(1UL << slot);
+
+	return slot;
+}
+
+void MG2639_Inbox::getDate(uint8_t slot, char * dest)
+{
+	uint32_t t = _entries[slot].timestamp;
+
+	sprintf(dest, "%02u/%02u/%02u %02u:%02u:%02u", (unsigned int) (t >> 26),
+	        (unsigned int) ((t >> 22) & 0x0F), (unsigned int) ((t >> 17) & 0x1F),
+	        (unsigned int) ((t >> 12) & 0x1F), (unsigned int) ((t >> 6) & 0x3F),
+	        (unsigned int) (t & 0x3F));
+}
+
+int8_t MG2639_Inbox::read(uint8_t slot)
+{
+	if (slot >= _count)
+		return ERROR_FAIL_RESPONSE;
+
+	return _sms->read(_entries[slot].index);
+}
+
+int8_t MG2639_Inbox::remove(uint8_t slot)
+{
+	int8_t iRetVal;
+	uint32_t low;
+
+	if (slot >= _count)
+		return ERROR_FAIL_RESPONSE;
+
+	iRetVal = _sms->deleteMessage(_entries[slot].index);
+	if (iRetVal <= 0)
+		return iRetVal;
+
+	// Close the gap in the table, and in the pending bits.
+	_count--;
+	memmove(&_entries[slot], &_entries[slot + 1], (_count - slot) * sizeof(inbox_entry));
+	low = _pending & ((1UL << slot) - 1);
+	_pending = low | ((_pending >> 1) & ~((1UL << slot) - 1));
+
+	return iRetVal;
+}
+
+uint32_t MG2639_Inbox::packDate(const char * date)
+{
+	unsigned int value[6] = {0, 0, 0, 0, 0, 0};
+	uint8_t field = 0;
+
+	// Six numbers, separated by anything. Stop at the time zone's sign.
+	while ((*date != '\0') && (field < 6))
+	{
+		if ((*date >= '0') && (*date <= '9'))
+		{
+			value[field] = value[field] * 10 + (*date - '0');
+			if ((date[1] < '0') || (date[1] > '9'))
+				field++;
+		}
+		date++;
+	}
+
+	return ((uint32_t) ((value[0] % 100) & 0x3F) << 26) |
+	       ((uint32_t) (value[1] & 0x0F) << 22) | ((uint32_t) (value[2] & 0x1F) << 17) |
+	       ((uint32_t) (value[3] & 0x1F) << 12) | ((uint32_t) (value[4] & 0x3F) << 6) |
+	       (value[5] & 0x3F);
+}
+
+uint16_t MG2639_Inbox::crc16(uint16_t crc, uint8_t b)
+{
+	crc ^= (uint16_t) b << 8;
+	for (int i = 0; i < 8; i++)
+	{
+		if (crc & 0x8000)
+			crc = (crc << 1) ^ 0x1021;
+		else
+			crc <<= 1;
+	}
+	return crc;
+}
@@ -0,0 +1,179 @@
+/******************************************************************************
+MG2639_Inbox.h
+MG2639 Cellular Shield Library - SMS Inbox Cache Header
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines an SMS inbox cache.
+MG2639_Inbox, a friend class of MG2639_Cell, lists the SIM's messages with a
+single AT+CMGL and keeps a compact table of them - SIM index, status, sender,
+timestamp, and the length and CRC-16 of the body. Bodies can be streamed to a
+callback during the same pass, or fetched later, one at a time, only for the
+messages you need.
+
+e.g.:	MG2639_Inbox inbox;
+		inbox.refresh(REC_UNREAD);
+		int slot;
+		while ((slot = inbox.next()) >= 0)
+			Serial.println(inbox.getSender(slot));
+
+The module must be in text mode (sms.setMode(SMS_TEXT_MODE)). Each table
+entry takes 25 bytes of RAM, so there's no global instance - declare one
+where you need it.
+
+The old way to drain the inbox - available() for the list, then read() for
+each message - lists every message (with its body) once, then sends a
+separate AT+CMGR per message. For a full SIM of 30 messages of 160
+characters, at 9600 baud:
+
+	                     | Commands | UART bytes | Time
+	---------------------+----------+------------+-------------------------
+	available() + read() | 31       | ~13,700    | ~14 s transfer, plus 30
+	(per message)        |          |            | command turnarounds
+	                     |          |            | (~0.1-0.3 s each): ~20 s
+	refresh() with body  | 1        | ~6,800     | ~7 s
+	callback (one pass)  |          |            |
+
+The byte counts follow from the response format. Use getRefreshTime() to
+time a refresh() on your SIM.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#ifndef _MG2639_INBOX_H_
+#define _MG2639_INBOX_H_
+
+#include <Arduino.h>
+#include "MG2639_SMS.h"
+
+// INBOX_SIZE - Number of messages kept in the table (32 or fewer). Messages
+// past this are still counted, and streamed to the body callback, but not
+// kept.
+#define INBOX_SIZE 10
+
+// INBOX_CHUNK_SIZE - Body bytes collected (on the stack) before they're
+// passed to the body callback.
+#define INBOX_CHUNK_SIZE 16
+
+// INBOX_LIST_TIMEOUT - Time (ms) to wait for the first line of the list.
+// After that, each character must arrive within COMMAND_RESPONSE_TIME.
+#define INBOX_LIST_TIMEOUT 5000
+
+/// inbox_body_fn - Called by refresh() with each piece of a message body as
+/// it arrives. [slot] is the table entry the message is stored in, or -1
+/// if the table is full.
+typedef void (*inbox_body_fn)(int8_t slot, const char * data, uint8_t length);
+
+class MG2639_Inbox
+{
+public:
+	/// MG2639_Inbox([modem]) - Constructor
+	/// Sets up class variables. Messages go through [modem] - the global sms
+	/// if it's left out.
+	MG2639_Inbox(MG2639_SMS & modem = sms);
+
+	/// refresh([status], [fn]) - List messages with AT+CMGL and rebuild the
+	/// table. [status] is REC_UNREAD, REC_READ or REC_ALL. Listing unread
+	/// messages marks them as read on the SIM.
+	/// If [fn] isn't NULL, every body is passed to it as it arrives - the
+	/// whole inbox is read in one pass.
+	///
+	/// Returns: Number of messages listed (may be more than INBOX_SIZE),
+	/// <0 on fail.
+	int refresh(sms_status status = REC_ALL, inbox_body_fn fn = NULL);
+
+	/// next() - Returns the table slot of the next message not yet returned
+	/// by next() since the last refresh(), or -1 if there are none left.
+	int next();
+
+	/// count() - Returns the number of messages in the table.
+	inline uint8_t count() { return _count; };
+
+	/// getListed() - Returns the number of messages the last refresh()
+	/// listed, including any that didn't fit in the table.
+	inline uint8_t getListed() { return _listed; };
+
+	/// getRefreshTime() - Returns the time (ms) the last refresh() took.
+	inline unsigned long getRefreshTime() { return _refreshTime; };
+
+	/////////////////////
+	// Message Details //
+	/////////////////////
+
+	/// getIndex([slot]) - Returns the SIM index of a message, for
+	/// sms.read() and sms.deleteMessage().
+	inline uint8_t getIndex(uint8_t slot) { return _entries[slot].index; };
+
+	/// getStatus([slot]) - Returns REC_UNREAD or REC_READ - or REC_ALL for
+	/// a stored outgoing message.
+	inline sms_status getStatus(uint8_t slot) { return (sms_status) _entries[slot].status; };
+
+	/// getSender([slot]) - Returns the sender's phone number (or name, cut
+	/// to MAX_PHONE_NUMBER_SIZE - 1 characters).
+	inline const char * getSender(uint8_t slot) { return _entries[slot].sender; };
+
+	/// getTimestamp([slot]) - Returns the date and time packed into 32 bits.
+	/// Newer messages have larger timestamps.
+	inline uint32_t getTimestamp(uint8_t slot) { return _entries[slot].timestamp; };
+
+	/// getDate([slot], [dest]) - Write the date to [dest] as
+	/// "yy/MM/dd hh:mm:ss". [dest] must have room for 18 characters.
+	void getDate(uint8_t slot, char * dest);
+
+	/// getLength([slot]) - Returns the length of the body (up to 255).
+	inline uint8_t getLength(uint8_t slot) { return _entries[slot].length; };
+
+	/// getHash([slot]) - Returns the CRC-16 of the body - e.g. to spot
+	/// repeated messages without keeping their text.
+	inline uint16_t getHash(uint8_t slot) { return _entries[slot].hash; };
+
+	////////////////////////
+	// Fetching, Deleting //
+	////////////////////////
+
+	/// read([slot]) - Fetch one message with sms.read(). Its body is then
+	/// returned by sms.getMessage().
+	///
+	/// Returns: >0 on success, <0 on fail.
+	int8_t read(uint8_t slot);
+
+	/// remove([slot]) - Delete a message from the SIM, and the table.
+	///
+	/// Returns: >0 on success, <0 on fail.
+	int8_t remove(uint8_t slot);
+
+private:
+	MG2639_SMS * _sms;
+	struct inbox_entry {
+		uint8_t index; // SIM index
+		uint8_t status; // sms_status
+		uint8_t length; // Body length, up to 255
+		uint16_t hash; // CRC-16 of the body
+		uint32_t timestamp; // Packed date, see packDate()
+		char sender[MAX_PHONE_NUMBER_SIZE];
+	};
+
+	inbox_entry _entries[INBOX_SIZE];
+	uint8_t _count;
+	uint8_t _listed;
+	uint32_t _pending; // Bit i set if slot i hasn't been returned by next()
+	unsigned long _refreshTime;
+
+	/// packDate([date]) - Pack "yy/MM/dd,hh:mm:ss+zz" (or with a 4-digit
+	/// year) into 32 bits: year since 2000 (6), month (4), day (5), hour
+	/// (5), minute (6), second (6). The time zone is dropped.
+	static uint32_t packDate(const char * date);
+
+	/// crc16([crc], [b]) - Add a byte to a CRC-16 (CCITT, 0x1021).
+	static uint16_t crc16(uint16_t crc, uint8_t b);
+};
+
+#endif
@@ -0,0 +1,480 @@
+/******************************************************************************
+MG2639_MQTT.cpp
+MG2639 Cellular Shield Library - MQTT Client Source
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines a small MQTT 3.1.1 client
+that runs on top of MG2639_GPRS. Packets are built in, and read into, a single
+fixed-size buffer.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include "MG2639_MQTT.h"
+#include <SFE_MG2639_CellShield.h>
+
+// MQTT control packet types (top 4 bits of the first byte)
+#define MQTT_CONNECT 1
+#define MQTT_CONNACK 2
+#define MQTT_PUBLISH 3
+#define MQTT_PUBACK 4
+#define MQTT_SUBSCRIBE 8
+#define MQTT_SUBACK 9
+#define MQTT_UNSUBSCRIBE 10
+#define MQTT_UNSUBACK 11
+#define MQTT_PINGREQ 12
+#define MQTT_PINGRESP 13
+#define MQTT_DISCONNECT 14
+
+// Packets are built starting at _buffer[MQTT_HEADER_SPACE]. The first byte
+// and the remaining length (1-4 bytes) are filled in just in front by send().
+#define MQTT_HEADER_SPACE 5
+
+MG2639_MQTT::MG2639_MQTT(MG2639_GPRS & modem)
+{
+	_gprs = &modem;
+	_length = 0;
+	_state = MQTT_DISCONNECTED;
+	_returnCode = 0;
+	_keepAlive = MQTT_KEEPALIVE;
+	_nextPacketId = 0;
+	_pingOutstanding = false;
+	_pingTime = 0;
+	_lastOut = 0;
+	_lastIn = 0;
+	_latency = 0;
+	_bytesSent = 0;
+	_bytesReceived = 0;
+	_callback = NULL;
+}
+
+int MG2639_MQTT::connect(const char * host, unsigned int port, const char * clientId,
+                         const char * user, const char * password)
+{
+	int iRetVal;
+	uint8_t flags = 0x02; // Clean session
+	
+	if (_gprs->connected())
+		_gprs->stop();
+	
+	_state = MQTT_CONNECT_FAILED;
+	_pingOutstanding = false;
+	_bytesSent = 0;
+	_bytesReceived = 0;
+	
+	iRetVal = _gprs->connect(host, port);
+	if (iRetVal < 0)
+		return iRetVal;
+	
+	if (user != NULL)
+		flags |= 0x80;
+	if (password != NULL)
+		flags |= 0x40;
+	
+	// Variable header: protocol name "MQTT", level 4 (3.1.1), flags and
+	// keep-alive. Then the payload: client ID, user name, password.
+	begin(MQTT_CONNECT << 4);
+	addString("MQTT");
+	addByte(4);
+	addByte(flags);
+	addWord(_keepAlive);
+	if (!addString(clientId) ||
+	    ((user != NULL) && !addString(user)) ||
+	    ((password != NULL) && !addString(password)))
+	{
+		_gprs->stop();
+		return ERROR_OVERRUN_PREVENT;
+	}
+	
+	iRetVal = send();
+	if (iRetVal > 0)
+		iRetVal = waitFor(MQTT_CONNACK, 0);
+	if (iRetVal < 0)
+	{
+		_gprs->stop();
+		return iRetVal;
+	}
+	
+	// CONNACK is [session present, return code]
+	_returnCode = _buffer[1];
+	if (_returnCode != 0)
+	{
+		_state = MQTT_CONNECT_REFUSED;
+		_gprs->stop();
+		return ERROR_FAIL_RESPONSE;
+	}
+	
+	_state = MQTT_CONNECTED;
+	_lastIn = millis();
+	
+	return SUCCESS_OK;
+}
+
+void MG2639_MQTT::disconnect()
+{
+	if (_state == MQTT_CONNECTED)
+	{
+		begin(MQTT_DISCONNECT << 4);
+		send();
+	}
+	_gprs->stop();
+	_state = MQTT_DISCONNECTED;
+}
+
+bool MG2639_MQTT::connected()
+{
+	return _state == MQTT_CONNECTED;
+}
+
+bool MG2639_MQTT::loop()
+{
+	int iRetVal;
+	unsigned long interval = (unsigned long) _keepAlive * 1000;
+	
+	if (_state != MQTT_CONNECTED)
+		return false;
+	
+	while ((iRetVal = readPacket()) > 0)
+		;
+	if ((iRetVal < 0) || !_gprs->connected())
+	{
+		lost();
+		return false;
+	}
+	
+	if (_keepAlive == 0)
+		return true;
+	
+	if (_pingOutstanding)
+	{
+		if (millis() - _pingTime > MQTT_TIMEOUT)
+		{
+			lost();
+			return false;
+		}
+	}
+	else if ((millis() - _lastOut >= interval) || (millis() - _lastIn >= interval))
+	{
+		// A PINGREQ also proves the link is still alive in both directions,
+		// so one is sent after a quiet spell either way.
+		begin(MQTT_PINGREQ << 4);
+		if (send() < 0)
+		{
+			lost();
+			return false;
+		}
+		_pingOutstanding = true;
+		_pingTime = millis();
+	}
+	
+	return true;
+}
+
+int MG2639_MQTT::publish(const char * topic, const uint8_t * payload, unsigned int length,
+                         uint8_t qos, bool retain)
+{
+	int iRetVal;
+	uint16_t id = 0;
+	unsigned long timeSent;
+	
+	if (_state != MQTT_CONNECTED)
+		return ERROR_FAIL_RESPONSE;
+	if (qos > 1)
+		qos = 1;
+	
+	begin((MQTT_PUBLISH << 4) | (qos << 1) | (retain ? 1 : 0));
+	if (!addString(topic))
+		return ERROR_OVERRUN_PREVENT;
+	if (qos > 0)
+	{
+		id = packetId();
+		addWord(id);
+	}
+	for (unsigned int i = 0; i < length; i++)
+	{
+		if (!addByte(payload[i]))
+			return ERROR_OVERRUN_PREVENT;
+	}
+	
+	timeSent = millis();
+	iRetVal = send();
+	if ((iRetVal < 0) || (qos == 0))
+		return iRetVal;
+	
+	iRetVal = waitFor(MQTT_PUBACK, id);
+	if (iRetVal > 0)
+		_latency = millis() - timeSent;
+	
+	return iRetVal;
+}
+
+int MG2639_MQTT::publish(const char * topic, const char * payload, uint8_t qos,
+                         bool retain)
+{
+	return publish(topic, (const uint8_t *) payload, strlen(payload), qos, retain);
+}
+
+int MG2639_MQTT::subscribe(const char * topic, uint8_t qos)
+{
+	int iRetVal;
+	uint16_t id;
+	
+	if (_state != MQTT_CONNECTED)
+		return ERROR_FAIL_RESPONSE;
+	
+	// SUBSCRIBE has the 0x02 flags set (required by the spec)
+	begin((MQTT_SUBSCRIBE << 4) | 0x02);
+	id = packetId();
+	addWord(id);
+	if (!addString(topic) || !addByte(qos > 1 ? 1 : qos))
+		return ERROR_OVERRUN_PREVENT;
+	
+	iRetVal = send();
+	if (iRetVal > 0)
+		iRetVal = waitFor(MQTT_SUBACK, id);
+	if (iRetVal < 0)
+		return iRetVal;
+	
+	// SUBACK is [packet ID, granted QoS]. 0x80 means the broker refused.
+	if ((_length < 3) || (_buffer[2] == 0x80))
+		return ERROR_FAIL_RESPONSE;
+	
+	return SUCCESS_OK;
+}
+
+int MG2639_MQTT::unsubscribe(const char * topic)
+{
+	int iRetVal;
+	uint16_t id;
+	
+	if (_state != MQTT_CONNECTED)
+		return ERROR_FAIL_RESPONSE;
+	
+	begin((MQTT_UNSUBSCRIBE << 4) | 0x02);
+	id = packetId();
+	addWord(id);
+	if (!addString(topic))
+		return ERROR_OVERRUN_PREVENT;
+	
+	iRetVal = send();
+	if (iRetVal > 0)
+		iRetVal = waitFor(MQTT_UNSUBACK, id);
+	
+	return iRetVal;
+}
+
+uint16_t MG2639_MQTT::packetId()
+{
+	_nextPacketId++;
+	if (_nextPacketId == 0)
+		_nextPacketId = 1;
+	
+	return _nextPacketId;
+}
+
+void MG2639_MQTT::begin(uint8_t type)
+{
+	_buffer[0] = type;
+	_length = MQTT_HEADER_SPACE;
+}
+
+bool MG2639_MQTT::addByte(uint8_t b)
+{
+	if (_length >= MQTT_BUFFER_SIZE)
+		return false;
+	
+	_buffer[_length++] = b;
+	return true;
+}
+
+bool MG2639_MQTT::addWord(uint16_t w)
+{
+	return addByte(w >> 8) && addByte(w & 0xFF);
+}
+
+bool MG2639_MQTT::addString(const char * str)
+{
+	unsigned int length = strlen(str);
+	
+	if (_length + 2 + length > MQTT_BUFFER_SIZE)
+		return false;
+	
+	addWord(length);
+	memcpy(_buffer + _length, str, length);
+	_length += length;
+	
+	return true;
+}
+
+int MG2639_MQTT::send()
+{
+	uint8_t lengthBytes[4];
+	uint8_t count = 0;
+	unsigned int remaining = _length - MQTT_HEADER_SPACE;
+	unsigned int start;
+	
+	// Remaining length is sent 7 bits per byte, low bits first. The top bit
+	// is set if more bytes follow.
+	do
+	{
+		lengthBytes[count] = remaining & 0x7F;
+		remaining >>= 7;
+		if (remaining > 0)
+			lengthBytes[count] |= 0x80;
+		count++;
+	} while (remaining > 0);
+	
+	// Move the first byte down, and put the length in front of the packet.
+	start = MQTT_HEADER_SPACE - 1 - count;
+	_buffer[start] = _buffer[0];
+	memcpy(_buffer + start + 1, lengthBytes, count);
+	
+	if (_gprs->write(_buffer + start, _length - start) != _length - start)
+		return ERROR_FAIL_RESPONSE;
+	
+	_bytesSent += _length - start;
+	_lastOut = millis();
+	
+	return SUCCESS_OK;
+}
+
+int MG2639_MQTT::sendShort(uint8_t type, uint16_t id)
+{
+	uint8_t packet[4] = {type, 2, (uint8_t) (id >> 8), (uint8_t) (id & 0xFF)};
+	
+	if (_gprs->write(packet, 4) != 4)
+		return ERROR_FAIL_RESPONSE;
+	
+	_bytesSent += 4;
+	_lastOut = millis();
+	
+	return SUCCESS_OK;
+}
+
+int MG2639_MQTT::readByte()
+{
+	unsigned long timeIn = millis();
+	
+	while (millis() - timeIn < MQTT_TIMEOUT)
+	{
+		if (_gprs->available())
+			return _gprs->read();
+	}
+	
+	return -1;
+}
+
+int MG2639_MQTT::readPacket()
+{
+	int first;
+	int b;
+	unsigned long remaining = 0;
+	unsigned long multiplier = 1;
+	uint8_t count = 0;
+	
+	if (!_gprs->available())
+		return 0;
+	
+	first = _gprs->read();
+	do
+	{
+		b = readByte();
+		if ((b < 0) || (++count > 4))
+			return ERROR_TIMEOUT;
+		remaining += (b & 0x7F) * multiplier;
+		multiplier <<= 7;
+	} while (b & 0x80);
+	
+	// Keep what fits in the buffer, skip the rest.
+	_length = 0;
+	for (unsigned long i = 0; i < remaining; i++)
+	{
+		b = readByte();
+		if (b < 0)
+			return ERROR_TIMEOUT;
+		if (_length < MQTT_BUFFER_SIZE)
+			_buffer[_length++] = b;
+	}
+	_bytesReceived += 1 + count + remaining;
+	_lastIn = millis();
+	
+	if ((first >> 4) == MQTT_PINGRESP)
+	{
+		_pingOutstanding = false;
+	}
+	else if (((first >> 4) == MQTT_PUBLISH) && (_length >= 2))
+	{
+		uint8_t qos = (first >> 1) & 0x03;
+		unsigned int topicLength = (_buffer[0] << 8) | _buffer[1];
+		unsigned int pos = 2 + topicLength;
+		uint16_t id = 0;
+	
+		if (qos > 0)
+		{
+			if (pos + 2 <= _length)
+				id = (_buffer[pos] << 8) | _buffer[pos + 1];
+			pos += 2;
+		}
+	
+		// Only whole messages are passed on. The topic is moved down two
+		// bytes, over its length, to make room for a terminating 0.
+		if ((remaining <= MQTT_BUFFER_SIZE) && (pos <= _length) &&
+		    (_callback != NULL))
+		{
+			memmove(_buffer, _buffer + 2, topicLength);
+			_buffer[topicLength] = '\0';
+			_callback((const char *) _buffer, _buffer + pos, _length - pos);
+		}
+	
+		// QoS 1 is acknowledged even if the message was too big to keep.
+		// Only QoS 0 and 1 are subscribed to, so QoS 2 never arrives.
+		if ((qos == 1) && (sendShort(MQTT_PUBACK << 4, id) < 0))
+			return ERROR_FAIL_RESPONSE;
+	}
+	
+	return first >> 4;
+}
+
+int MG2639_MQTT::waitFor(uint8_t type, uint16_t id)
+{
+	int iRetVal;
+	unsigned long timeIn = millis();
+	
+	while (millis() - timeIn < MQTT_TIMEOUT)
+	{
+		iRetVal = readPacket();
+		if (iRetVal < 0)
+		{
+			lost();
+			return iRetVal;
+		}
+		if ((iRetVal == type) && (_length >= 2) &&
+		    ((id == 0) || (((_buffer[0] << 8) | _buffer[1]) == id)))
+			return SUCCESS_OK;
+		if ((iRetVal == 0) && !_gprs->connected())
+		{
+			lost();
+			return ERROR_FAIL_RESPONSE;
+		}
+	}
+	
+	return ERROR_TIMEOUT;
+}
+
+void MG2639_MQTT::lost()
+{
+	if (_state == MQTT_CONNECTED)
+		_state = MQTT_CONNECTION_LOST;
+	_gprs->stop();
+}
+
+MG2639_MQTT mqtt;
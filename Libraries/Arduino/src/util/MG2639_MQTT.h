@@ -0,0 +1,239 @@
+/******************************************************************************
+MG2639_MQTT.h
+MG2639 Cellular Shield Library - MQTT Client Header
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines a small MQTT 3.1.1 client
+that runs on top of MG2639_GPRS. MG2639_MQTT keeps one TCP link to a broker
+open, and can publish and subscribe at QoS 0 or 1. Packets are built in, and
+read into, a single MQTT_BUFFER_SIZE byte buffer - no heap is used.
+
+e.g.:	mqtt.connect("broker.example.com", 1883, "cellshield");
+		mqtt.publish("sensors/a0", "512");
+		// Then call mqtt.loop() every time through loop()
+
+Each packet is sent with one write() - one +ZIPSEND. For a 10 character
+topic and a 4 byte payload:
+
+	                 | Bytes sent        | Bytes received | Round trips
+	-----------------+-------------------+----------------+------------
+	QoS 0 publish    | 18                | 0              | 0
+	QoS 1 publish    | 20                | 4 (PUBACK)     | 1
+	PINGREQ          | 2                 | 2 (PINGRESP)   | 1
+	HTTP POST bridge | ~150-270          | ~150-300       | 1 + TCP setup
+
+The publish itself spends most of its time in the +ZIPSEND exchange with the
+module (~30 characters of command and response at 9600 baud, plus the wait
+for "+ZIPSEND: OK"). A QoS 1 publish also waits for the PUBACK - one GPRS
+round trip, typically 300-1000 ms. getLatency() reports the PUBACK time on
+your network.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#ifndef _MG2639_MQTT_H_
+#define _MG2639_MQTT_H_
+
+#include <Arduino.h>
+#include "MG2639_GPRS.h"
+
+// MQTT_BUFFER_SIZE - Largest packet that can be sent or received. An
+// incoming publish that doesn't fit is read and thrown away (and still
+// acknowledged, if it's QoS 1).
+#define MQTT_BUFFER_SIZE 128
+
+// MQTT_KEEPALIVE - Default keep-alive interval (seconds). If nothing is sent
+// for this long, loop() sends a PINGREQ. Mobile operators' NAT gateways
+// typically forget an idle TCP link after 2-5 minutes, and the module
+// doesn't notice when they do, so the default stays well below that.
+// Change it with setKeepAlive() before connect().
+#define MQTT_KEEPALIVE 60
+
+// MQTT_TIMEOUT - Time (ms) to wait for CONNACK, SUBACK or a QoS 1 PUBACK.
+// Also the time a PINGRESP may take before the link is considered dead.
+#define MQTT_TIMEOUT 10000
+
+// mqtt_state - Values returned by state():
+// 0: MQTT_DISCONNECTED - Not connected, or disconnect() was called
+// 1: MQTT_CONNECTED - Connected to the broker
+// -1: MQTT_CONNECTION_LOST - The link closed, or a PINGRESP didn't arrive
+// -2: MQTT_CONNECT_FAILED - The TCP link couldn't be set up
+// -3: MQTT_CONNECT_REFUSED - The broker refused the CONNECT (getReturnCode())
+enum mqtt_state {
+	MQTT_CONNECT_REFUSED = -3,
+	MQTT_CONNECT_FAILED = -2,
+	MQTT_CONNECTION_LOST = -1,
+	MQTT_DISCONNECTED = 0,
+	MQTT_CONNECTED = 1
+};
+
+/// mqtt_callback_fn - Called by loop() (or while waiting for an ack) with
+/// each message received on a subscribed topic. [topic] is 0-terminated.
+typedef void (*mqtt_callback_fn)(const char * topic, const uint8_t * payload,
+                                 unsigned int length);
+
+class MG2639_MQTT
+{
+public:
+	/// MG2639_MQTT([modem]) - Constructor
+	/// Sets up class variables. Packets go through [modem] - the global gprs
+	/// if it's left out.
+	MG2639_MQTT(MG2639_GPRS & modem = gprs);
+	
+	////////////////
+	// Connection //
+	////////////////
+	
+	/// connect([host], [port], [clientId], [user], [password]) - Open a TCP
+	/// link to the broker and send CONNECT, with a clean session.
+	/// gprs.open() must be called first. [user] and [password] are
+	/// optional.
+	///
+	/// Returns: >0 on success, <0 on fail (ERROR_FAIL_RESPONSE if the
+	/// broker refused the connection - see getReturnCode()).
+	int connect(const char * host, unsigned int port, const char * clientId,
+	            const char * user = NULL, const char * password = NULL);
+	
+	/// disconnect() - Send DISCONNECT and close the TCP link.
+	void disconnect();
+	
+	/// connected() - Returns true if connected to the broker. No packet is
+	/// sent - a dead link is noticed by loop().
+	bool connected();
+	
+	/// state() - Returns the current mqtt_state.
+	inline mqtt_state state() { return _state; };
+	
+	/// getReturnCode() - Returns the CONNACK return code from the last
+	/// connect(). 0 is accepted, 1-5 are the reasons for refusal (4 is bad
+	/// user name or password, 5 is not authorized).
+	inline uint8_t getReturnCode() { return _returnCode; };
+	
+	/// setKeepAlive([seconds]) - Keep-alive interval sent with the next
+	/// connect(). 0 disables keep-alive pings.
+	inline void setKeepAlive(unsigned int seconds) { _keepAlive = seconds; };
+	
+	/// setCallback([fn]) - [fn] is called with each message received.
+	inline void setCallback(mqtt_callback_fn fn) { _callback = fn; };
+	
+	/// loop() - Read incoming packets, pass messages to the callback, and
+	/// send a PINGREQ when keep-alive is due. This is a polling function -
+	/// call it in loop() and call it often.
+	///
+	/// Returns: true if still connected.
+	bool loop();
+	
+	////////////////////////
+	// Publish, Subscribe //
+	////////////////////////
+	
+	/// publish([topic], [payload], [length], [qos], [retain]) - Publish a
+	/// message. At QoS 1, waits up to MQTT_TIMEOUT for the broker's PUBACK.
+	/// Messages that arrive in the meantime are passed to the callback.
+	///
+	/// Returns: >0 on success, <0 on fail
+	/// (ERROR_OVERRUN_PREVENT if the packet doesn't fit in
+	/// MQTT_BUFFER_SIZE, ERROR_TIMEOUT if the PUBACK didn't arrive).
+	int publish(const char * topic, const uint8_t * payload, unsigned int length,
+	            uint8_t qos = 0, bool retain = false);
+	int publish(const char * topic, const char * payload, uint8_t qos = 0,
+	            bool retain = false);
+	
+	/// subscribe([topic], [qos]) - Subscribe to [topic] (wildcards are
+	/// allowed) and wait for the SUBACK.
+	///
+	/// Returns: >0 on success, <0 on fail (ERROR_FAIL_RESPONSE if the broker
+	/// refused the subscription).
+	int subscribe(const char * topic, uint8_t qos = 0);
+	
+	/// unsubscribe([topic]) - Unsubscribe from [topic] and wait for the
+	/// UNSUBACK.
+	///
+	/// Returns: >0 on success, <0 on fail
+	int unsubscribe(const char * topic);
+	
+	/////////////////////
+	// MQTT Statistics //
+	/////////////////////
+	
+	/// getLatency() - Returns the time (ms) from sending the last QoS 1
+	/// PUBLISH to receiving its PUBACK, including the +ZIPSEND exchange.
+	inline unsigned long getLatency() { return _latency; };
+	
+	/// getBytesSent() and getBytesReceived() - MQTT bytes sent and received
+	/// since connect(). TCP/IP headers and the module's AT framing aren't
+	/// included.
+	inline unsigned long getBytesSent() { return _bytesSent; };
+	inline unsigned long getBytesReceived() { return _bytesReceived; };
+
+private:
+	MG2639_GPRS * _gprs;
+	uint8_t _buffer[MQTT_BUFFER_SIZE];
+	unsigned int _length; // Bytes in _buffer
+	
+	mqtt_state _state;
+	uint8_t _returnCode;
+	unsigned int _keepAlive;
+	uint16_t _nextPacketId;
+	bool _pingOutstanding;
+	unsigned long _pingTime; // millis() when the PINGREQ was sent
+	unsigned long _lastOut; // millis() of the last packet sent
+	unsigned long _lastIn; // millis() of the last packet received
+	unsigned long _latency;
+	unsigned long _bytesSent;
+	unsigned long _bytesReceived;
+	mqtt_callback_fn _callback;
+	
+	/// packetId() - Returns the next packet ID. IDs run 1-65535, 0 isn't
+	/// allowed.
+	uint16_t packetId();
+	
+	/// begin([type]) - Start building a packet of [type] (the whole first
+	/// byte, type and flags). Room is left for the longest remaining length.
+	void begin(uint8_t type);
+	
+	/// addByte([b]), addWord([w]), addString([str]) - Add to the packet.
+	/// Strings are sent with a two byte length in front.
+	/// Return: false if the buffer is full.
+	bool addByte(uint8_t b);
+	bool addWord(uint16_t w);
+	bool addString(const char * str);
+	
+	/// send() - Fill in the remaining length and send the packet.
+	/// Returns: >0 on success, <0 on fail
+	int send();
+	
+	/// sendShort([type], [id]) - Send a 4 byte packet (PUBACK) with [id].
+	int sendShort(uint8_t type, uint16_t id);
+	
+	/// readByte() - Read a byte from gprs, waiting up to MQTT_TIMEOUT.
+	/// Returns: The byte, or -1 if it timed out.
+	int readByte();
+	
+	/// readPacket() - If a packet has started to arrive, read it into
+	/// _buffer. PUBLISH packets are handled (callback, PUBACK) here.
+	/// Returns: The packet type (top 4 bits of the first byte), 0 if nothing
+	/// arrived, <0 on fail.
+	int readPacket();
+	
+	/// waitFor([type], [id]) - Read packets until one of [type] with packet
+	/// ID [id] arrives, or MQTT_TIMEOUT passes.
+	/// Returns: >0 on success, <0 on fail
+	int waitFor(uint8_t type, uint16_t id);
+	
+	/// lost() - Close the link after an error.
+	void lost();
+};
+
+extern MG2639_MQTT mqtt;
+
+#endif
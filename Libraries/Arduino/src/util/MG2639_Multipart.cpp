@@ -0,0 +1,386 @@
+/******************************************************************************
+MG2639_Multipart.cpp
+MG2639 Cellular Shield Library - Concatenated SMS Source
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines concatenated (multipart)
+SMS on top of MG2639_PDU. MG2639_Multipart, a friend class of MG2639_Cell,
+splits long messages when sending, and reassembles them when receiving.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include "MG2639_Multipart.h"
+#include "MG2639_AT.h"
+#include <SFE_MG2639_CellShield.h>
+
+// Room left in each part after the 6-byte concatenation header
+#define PART_SEPTETS 153
+#define PART_BYTES 134
+#define PART_UNITS 67
+
+// textPartEnd([text], [start], [length], [ucs2]) - Returns the end of the
+// part of [text] starting at [start]. An escaped character takes two
+// septets, and is never split from its escape. With [ucs2], parts are
+// counted in 16-bit units, and never split a surrogate pair. No part splits
+// a UTF-8 character, or is over 255 bytes.
+static unsigned int textPartEnd(const char * text, unsigned int start,
+                                unsigned int length, bool ucs2)
+{
+	unsigned int first = start;
+	uint8_t count = 0;
+	uint8_t cost;
+	const char * p;
+	uint32_t c;
+	
+	while (start < length)
+	{
+		p = &text[start];
+		c = MG2639_PDU::nextUTF8(&p, &text[length]);
+		if (ucs2)
+			cost = (c > 0xFFFF) ? 2 : 1;
+		else
+			cost = (MG2639_PDU::toGSM(c) & 0x80) ? 2 : 1;
+		if ((count + cost > (ucs2 ? PART_UNITS : PART_SEPTETS)) ||
+		    (p - &text[first] > 255))
+			break;
+		count += cost;
+		start = p - text;
+	}
+	return start;
+}
+
+MG2639_Multipart::MG2639_Multipart(MG2639_PDU & pdu)
+{
+	_pdu = &pdu;
+	for (uint8_t i = 0; i < MULTIPART_SLOTS; i++)
+		_entries[i].total = 0;
+	_reference = 0;
+	_timeout = MULTIPART_TIMEOUT;
+	_dropped = 0;
+	_scanned = false;
+}
+
+int MG2639_Multipart::send(const char * number, const char * text)
+{
+	int iRetVal;
+	unsigned int length = strlen(text);
+	unsigned int start, end;
+	unsigned int parts = 0;
+	uint8_t udh[5];
+	bool ucs2 = !MG2639_PDU::isGSM(text, length);
+	
+	// If it fits in one message, it doesn't need a header.
+	if (ucs2 ? (MG2639_PDU::ucs2Length(text, length) <= 70) :
+	           (MG2639_PDU::septets(text, length) <= 160))
+	{
+		iRetVal = _pdu->send(number, text);
+		return (iRetVal > 0) ? 1 : iRetVal;
+	}
+	
+	for (start = 0; start < length; start = end)
+	{
+		end = textPartEnd(text, start, length, ucs2);
+		parts++;
+	}
+	if (parts > 255)
+		return ERROR_OVERRUN_PREVENT;
+	
+	// Concatenation, 8-bit reference: IEI 0, length 3, reference, parts, part
+	udh[0] = 0x00;
+	udh[1] = 3;
+	udh[2] = _reference++;
+	udh[3] = parts;
+	udh[4] = 0;
+	for (start = 0; start < length; start = end)
+	{
+		end = textPartEnd(text, start, length, ucs2);
+		udh[4]++;
+		if (ucs2)
+			iRetVal = _pdu->send(number, &text[start], end - start, udh, 5);
+		else
+			iRetVal = _pdu->send(number, (const uint8_t *) &text[start], end - start,
+			                     PDU_DCS_7BIT, udh, 5);
+		if (iRetVal < 0)
+			return iRetVal;
+	}
+	
+	return parts;
+}
+
+int MG2639_Multipart::send(const char * number, const uint8_t * data, unsigned int length)
+{
+	int iRetVal;
+	unsigned int start, part;
+	unsigned int parts = (length + PART_BYTES - 1) / PART_BYTES;
+	uint8_t udh[5];
+	
+	if (length <= 140)
+	{
+		iRetVal = _pdu->send(number, data, length);
+		return (iRetVal > 0) ? 1 : iRetVal;
+	}
+	if (parts > 255)
+		return ERROR_OVERRUN_PREVENT;
+	
+	udh[0] = 0x00;
+	udh[1] = 3;
+	udh[2] = _reference++;
+	udh[3] = parts;
+	for (start = 0, part = 1; start < length; start += PART_BYTES, part++)
+	{
+		udh[4] = part;
+		iRetVal = _pdu->send(number, &data[start],
+		                     (length - start > PART_BYTES) ? PART_BYTES : length - start,
+		                     PDU_DCS_8BIT, udh, 5);
+		if (iRetVal < 0)
+			return iRetVal;
+	}
+	
+	return parts;
+}
+
+int MG2639_Multipart::add(uint8_t msgIndex, multipart_fn fn)
+{
+	int iRetVal;
+	multipart_entry * entry = NULL;
+	multipart_entry * oldest = NULL;
+	const uint8_t * udh;
+	uint8_t udhLength;
+	uint16_t reference = 0;
+	uint16_t sender;
+	uint8_t total = 1;
+	uint8_t part = 1;
+	uint8_t i;
+	
+	expire();
+	
+	// A part we're already holding?
+	for (i = 0; i < MULTIPART_SLOTS; i++)
+	{
+		for (uint8_t p = 0; p < _entries[i].total; p++)
+		{
+			if ((_entries[i].received & (1 << p)) && (_entries[i].index[p] == msgIndex))
+				return 0;
+		}
+	}
+	
+	iRetVal = _pdu->read(msgIndex);
+	if (iRetVal < 0)
+		return iRetVal;
+	
+	// Look for a concatenation element - 8-bit (IEI 0) or 16-bit (IEI 8)
+	// reference. Other elements are stepped over.
+	udh = _pdu->getUDH();
+	udhLength = _pdu->getUDHLength();
+	for (i = 0; i + 1 < udhLength; i += udh[i + 1] + 2)
+	{
+		if ((udh[i] == 0x00) && (udh[i + 1] == 3) && (i + 4 < udhLength))
+		{
+			reference = udh[i + 2];
+			total = udh[i + 3];
+			part = udh[i + 4];
+		}
+		else if ((udh[i] == 0x08) && (udh[i + 1] == 4) && (i + 5 < udhLength))
+		{
+			reference = ((uint16_t) udh[i + 2] << 8) | udh[i + 3];
+			total = udh[i + 4];
+			part = udh[i + 5];
+		}
+	}
+	
+	if (total <= 1)
+	{	// Not split - deliver it now
+		if (fn != NULL)
+			fn(_pdu->getSender(), _pdu->getData(), _pdu->getLength(), 1, 1);
+		_pdu->getSMS().deleteMessage(msgIndex);
+		return 1;
+	}
+	if ((part == 0) || (part > total))
+	{
+		_pdu->getSMS().deleteMessage(msgIndex);
+		return ERROR_UNKNOWN_RESPONSE;
+	}
+	if (total > MULTIPART_MAX_PARTS)
+	{
+		_pdu->getSMS().deleteMessage(msgIndex);
+		return ERROR_OVERRUN_PREVENT;
+	}
+	
+	// Find the message this is part of, or make room for it.
+	sender = hash(_pdu->getSender());
+	for (i = 0; (i < MULTIPART_SLOTS) && (entry == NULL); i++)
+	{
+		if ((_entries[i].total == total) && (_entries[i].reference == reference) &&
+		    (_entries[i].sender == sender))
+			entry = &_entries[i];
+	}
+	for (i = 0; (i < MULTIPART_SLOTS) && (entry == NULL); i++)
+	{
+		if (_entries[i].total == 0)
+			entry = &_entries[i];
+		else if ((oldest == NULL) ||
+		         (millis() - _entries[i].lastPart > millis() - oldest->lastPart))
+			oldest = &_entries[i];
+	}
+	if (entry == NULL)
+	{
+		drop(oldest);
+		_dropped++;
+		entry = oldest;
+	}
+	if (entry->total == 0)
+	{
+		entry->reference = reference;
+		entry->sender = sender;
+		entry->total = total;
+		entry->received = 0;
+	}
+	
+	if (entry->received & (1 << (part - 1)))
+	{	// A repeat of a part we already have
+		_pdu->getSMS().deleteMessage(msgIndex);
+		return 0;
+	}
+	entry->index[part - 1] = msgIndex;
+	entry->received |= 1 << (part - 1);
+	entry->lastPart = millis();
+	
+	if (entry->received != (1 << total) - 1)
+		return 0;
+	
+	return deliver(entry, fn);
+}
+
+int MG2639_Multipart::poll(multipart_fn fn)
+{
+	int iRetVal;
+	char tempCmd[10];
+	uint8_t found[MESSAGE_INDEX_MAX];
+	long msgIndex;
+	int delivered = 0;
+	MG2639_SMS & modem = _pdu->getSMS();
+	
+	expire();
+	
+	if (modem.getMode() != SMS_PDU_MODE)
+	{
+		iRetVal = modem.setMode(SMS_PDU_MODE);
+		if (iRetVal < 0)
+			return iRetVal;
+	}
+	
+	// In PDU mode, 0 lists unread messages and 4 lists all of them.
+	// Example response:
+	// +CMGL: 1,0,,39\r\n
+	// 07913110101010F1440B91...\r\n
+	// \r\n
+	// OK
+	memset(found, 0, MESSAGE_INDEX_MAX);
+	sprintf(tempCmd, "%s=%d", SMS_LIST, _scanned ? 0 : 4);
+	modem.getCell().clearSerial();
+	modem.getCell().clearBuffer();
+	modem.getCell().sendATCommand((const char *)tempCmd);
+	iRetVal = modem.getCell().readWaitForResponses("+CMGL: ", RESPONSE_OK, SMS_COMMAND_TIMEOUT);
+	while (iRetVal > 0)
+	{
+		msgIndex = modem.getCell().readNumber(',', COMMAND_RESPONSE_TIME);
+		if (msgIndex < 0)
+			return msgIndex;
+		if (msgIndex < (MESSAGE_INDEX_MAX << 3))
+			found[msgIndex >> 3] |= 1 << (msgIndex & 7);
+		iRetVal = modem.getCell().readWaitForResponses("+CMGL: ", RESPONSE_OK, SMS_COMMAND_TIMEOUT);
+	}
+	// Reading "OK" is the end of the list
+	if (iRetVal != ERROR_FAIL_RESPONSE)
+		return iRetVal;
+	_scanned = true;
+	
+	// Only the indices were kept - each message is read again by add().
+	for (int i = 0; i < (MESSAGE_INDEX_MAX << 3); i++)
+	{
+		if (found[i >> 3] & (1 << (i & 7)))
+		{
+			if (add(i, fn) > 0)
+				delivered++;
+		}
+	}
+	
+	return delivered;
+}
+
+uint8_t MG2639_Multipart::getPending()
+{
+	uint8_t pending = 0;
+	
+	for (uint8_t i = 0; i < MULTIPART_SLOTS; i++)
+	{
+		if (_entries[i].total > 0)
+			pending++;
+	}
+	return pending;
+}
+
+int MG2639_Multipart::deliver(multipart_entry * entry, multipart_fn fn)
+{
+	int iRetVal;
+	
+	for (uint8_t p = 0; p < entry->total; p++)
+	{
+		iRetVal = _pdu->read(entry->index[p]);
+		if (iRetVal < 0)
+		{
+			drop(entry);
+			_dropped++;
+			return iRetVal;
+		}
+		if (fn != NULL)
+			fn(_pdu->getSender(), _pdu->getData(), _pdu->getLength(), p + 1, entry->total);
+	}
+	drop(entry);
+	
+	return 1;
+}
+
+void MG2639_Multipart::drop(multipart_entry * entry)
+{
+	for (uint8_t p = 0; p < entry->total; p++)
+	{
+		if (entry->received & (1 << p))
+			_pdu->getSMS().deleteMessage(entry->index[p]);
+	}
+	entry->total = 0;
+}
+
+void MG2639_Multipart::expire()
+{
+	for (uint8_t i = 0; i < MULTIPART_SLOTS; i++)
+	{
+		if ((_entries[i].total > 0) && (millis() - _entries[i].lastPart > _timeout))
+		{
+			drop(&_entries[i]);
+			_dropped++;
+		}
+	}
+}
+
+uint16_t MG2639_Multipart::hash(const char * str)
+{
+	uint32_t h = 2166136261UL;
+	
+	while (*str != '\0')
+	{
+		h ^= (uint8_t) *str++;
+		h *= 16777619UL;
+	}
+	return (h >> 16) ^ (h & 0xFFFF);
+}
@@ -0,0 +1,159 @@
+/******************************************************************************
+MG2639_Multipart.h
+MG2639 Cellular Shield Library - Concatenated SMS Header
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines concatenated (multipart)
+SMS on top of MG2639_PDU. MG2639_Multipart splits long messages into parts
+with a concatenation header (UDH) when sending, and puts them back together
+when receiving.
+
+e.g.:	MG2639_PDU pdu;
+		MG2639_Multipart multipart(pdu);
+		multipart.send("+13035551234", longAlertText);
+		// Then, in loop():
+		multipart.poll(onMessage);
+
+Received parts stay on the SIM until the whole message has arrived. The
+reassembly table only keeps where they are - the reference number, sender,
+part count and SIM index of each part, 14 bytes per message - not their
+text. Parts can arrive in any order. Once the last part is in, the callback
+is given every part, in order, and the parts are deleted from the SIM. A
+message that stays incomplete for MULTIPART_TIMEOUT, or is pushed out of the
+table by newer ones, is dropped and its parts deleted.
+
+Each part carries a 6-byte header (5-byte UDH and its length), which leaves
+153 7-bit characters, 67 UCS2 characters or 134 bytes of 8-bit data per
+part. A 400-character alert takes 3 messages - 6 if it needs UCS2.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#ifndef _MG2639_MULTIPART_H_
+#define _MG2639_MULTIPART_H_
+
+#include <Arduino.h>
+#include "MG2639_PDU.h"
+
+// MULTIPART_SLOTS - Number of incomplete messages kept at once. When a part
+// of another message arrives, the oldest is dropped.
+#define MULTIPART_SLOTS 4
+
+// MULTIPART_MAX_PARTS - Most parts a received message can have (8 or
+// fewer). Longer messages are deleted as they arrive.
+#define MULTIPART_MAX_PARTS 4
+
+// MULTIPART_TIMEOUT - Default time (ms) an incomplete message is kept after
+// its last part arrived. Change it with setTimeout().
+#define MULTIPART_TIMEOUT 600000
+
+/// multipart_fn - Called by add() or poll() with each part of a complete
+/// message, in order - [part] runs from 1 to [total]. A message that wasn't
+/// split comes as part 1 of 1. 7-bit text is as from pdu.getData() - ASCII,
+/// with other GSM characters as bytes from 0x80. pdu.getText() gives any
+/// text part (7-bit or UCS2, see pdu.getDCS()) as UTF-8.
+typedef void (*multipart_fn)(const char * sender, const uint8_t * data,
+                             uint8_t length, uint8_t part, uint8_t total);
+
+class MG2639_Multipart
+{
+public:
+	/// MG2639_Multipart([pdu]) - Constructor
+	/// [pdu] is used to send, and to read each part - through the modem
+	/// [pdu] was built with.
+	MG2639_Multipart(MG2639_PDU & pdu);
+	
+	/////////////
+	// Sending //
+	/////////////
+	
+	/// send([number], [text]) - Send UTF-8 [text] to [number], in as many
+	/// parts as it needs - as 7-bit text, or UCS2 if any character isn't in
+	/// the GSM alphabet (67 characters a part). Escaped characters ([, ], {
+	/// etc.) are never split from their escape, nor UTF-8 characters.
+	///
+	/// Returns: Number of parts sent on success, <0 on fail (parts before
+	/// the one that failed will have been sent).
+	int send(const char * number, const char * text);
+	
+	/// send([number], [data], [length]) - Send [length] bytes of binary
+	/// [data] to [number] as 8-bit, in as many parts as it needs.
+	///
+	/// Returns: Number of parts sent on success, <0 on fail.
+	int send(const char * number, const uint8_t * data, unsigned int length);
+	
+	///////////////
+	// Receiving //
+	///////////////
+	
+	/// add([msgIndex], [fn]) - Read the message at [msgIndex] (with
+	/// pdu.read()). If it completes a message, pass every part to [fn] and
+	/// delete them from the SIM. Adding the same index twice does nothing.
+	///
+	/// Returns: 1 if a message was delivered, 0 if it's waiting for more
+	/// parts, <0 on fail (ERROR_OVERRUN_PREVENT if it has more than
+	/// MULTIPART_MAX_PARTS parts - it's deleted).
+	int add(uint8_t msgIndex, multipart_fn fn);
+	
+	/// poll([fn]) - List the SIM's unread messages and add() each. The first
+	/// poll() lists every message, to pick up parts left from before a reset.
+	/// Every message on the SIM is delivered and deleted, so don't mix this
+	/// with other readers. Also drops messages past the timeout.
+	///
+	/// Returns: Number of messages delivered, <0 on fail.
+	int poll(multipart_fn fn);
+	
+	/// setTimeout([ms]) - Time an incomplete message is kept after its last
+	/// part arrived.
+	inline void setTimeout(unsigned long ms) { _timeout = ms; };
+	
+	/// getPending() - Returns the number of incomplete messages in the
+	/// table.
+	uint8_t getPending();
+	
+	/// getDropped() - Returns the number of incomplete messages dropped
+	/// (timed out or pushed out of the table) since the constructor.
+	inline unsigned int getDropped() { return _dropped; };
+
+private:
+	struct multipart_entry {
+		uint16_t reference; // Concatenation reference number
+		uint16_t sender; // Hash of the sender
+		uint8_t total; // Number of parts, 0 if the slot is free
+		uint8_t received; // Bit i set when part i + 1 is on the SIM
+		unsigned long lastPart; // millis() when the last part arrived
+		uint8_t index[MULTIPART_MAX_PARTS]; // SIM index of each part
+	};
+	
+	MG2639_PDU * _pdu;
+	multipart_entry _entries[MULTIPART_SLOTS];
+	uint8_t _reference; // Reference for the next message sent
+	unsigned long _timeout;
+	unsigned int _dropped;
+	bool _scanned; // Has poll() listed every message yet?
+	
+	/// deliver([entry], [fn]) - Read every part of a complete message,
+	/// in order, and pass them to [fn]. Then delete them.
+	/// Returns: 1 on success, <0 if a part couldn't be read.
+	int deliver(multipart_entry * entry, multipart_fn fn);
+	
+	/// drop([entry]) - Delete an entry's parts from the SIM and free it.
+	void drop(multipart_entry * entry);
+	
+	/// expire() - Drop entries past the timeout.
+	void expire();
+	
+	/// hash([str]) - Returns a 16-bit hash of [str] (FNV-1a, folded).
+	static uint16_t hash(const char * str);
+};
+
+#endif
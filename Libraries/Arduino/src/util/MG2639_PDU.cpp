@@ -0,0 +1,815 @@
+/******************************************************************************
+MG2639_PDU.cpp
+MG2639 Cellular Shield Library - PDU-Mode SMS Source
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines a PDU-mode SMS codec.
+MG2639_PDU, a friend class of MG2639_Cell, builds SMS-SUBMIT PDUs and parses
+SMS-DELIVER PDUs.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include "MG2639_PDU.h"
+#include "MG2639_AT.h"
+#include <SFE_MG2639_CellShield.h>
+
+// asciiToGSM - GSM 03.38 septet for each ASCII character. 0x80 | septet is a
+// character from the extension table (sent after a 0x1B escape). Characters
+// with no GSM equivalent are sent as '?'.
+static const uint8_t asciiToGSM[128] PROGMEM = {
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, // 0x00
+	0x3F, 0x3F, 0x0A, 0x3F, 0x8A, 0x0D, 0x3F, 0x3F, // 0x08
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, // 0x10
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, // 0x18
+	0x20, 0x21, 0x22, 0x23, 0x02, 0x25, 0x26, 0x27, // 0x20
+	0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, // 0x28
+	0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, // 0x30
+	0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F, // 0x38
+	0x00, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, // 0x40
+	0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, // 0x48
+	0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, // 0x50
+	0x58, 0x59, 0x5A, 0xBC, 0xAF, 0xBE, 0x94, 0x11, // 0x58
+	0x3F, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, // 0x60
+	0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, // 0x68
+	0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, // 0x70
+	0x78, 0x79, 0x7A, 0xA8, 0xC0, 0xA9, 0xBD, 0x3F // 0x78
+};
+
+// gsmToUnicode - Unicode character for each GSM 03.38 septet. The escape
+// (0x1B) is shown as a space.
+static const uint16_t gsmToUnicode[128] PROGMEM = {
+	0x0040, 0x00A3, 0x0024, 0x00A5, 0x00E8, 0x00E9, 0x00F9, 0x00EC, // 0x00
+	0x00F2, 0x00C7, 0x000A, 0x00D8, 0x00F8, 0x000D, 0x00C5, 0x00E5, // 0x08
+	0x0394, 0x005F, 0x03A6, 0x0393, 0x039B, 0x03A9, 0x03A0, 0x03A8, // 0x10
+	0x03A3, 0x0398, 0x039E, 0x0020, 0x00C6, 0x00E6, 0x00DF, 0x00C9, // 0x18
+	0x0020, 0x0021, 0x0022, 0x0023, 0x00A4, 0x0025, 0x0026, 0x0027, // 0x20
+	0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, // 0x28
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, // 0x30
+	0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, // 0x38
+	0x00A1, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, // 0x40
+	0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, // 0x48
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, // 0x50
+	0x0058, 0x0059, 0x005A, 0x00C4, 0x00D6, 0x00D1, 0x00DC, 0x00A7, // 0x58
+	0x00BF, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, // 0x60
+	0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, // 0x68
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, // 0x70
+	0x0078, 0x0079, 0x007A, 0x00E4, 0x00F6, 0x00F1, 0x00FC, 0x00E0 // 0x78
+};
+
+// The euro sign is the only character in the extension table that isn't
+// ASCII.
+#define GSM_EURO 0x65
+#define UNICODE_EURO 0x20AC
+
+// gsmToASCII - ASCII character for each GSM 03.38 septet. Accented letters
+// become the closest ASCII letter, other symbols '?'.
+static const uint8_t gsmToASCII[128] PROGMEM = {
+	0x40, 0x3F, 0x24, 0x3F, 0x65, 0x65, 0x75, 0x69, // 0x00
+	0x6F, 0x43, 0x0A, 0x4F, 0x6F, 0x0D, 0x41, 0x61, // 0x08
+	0x3F, 0x5F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, // 0x10
+	0x3F, 0x3F, 0x3F, 0x20, 0x41, 0x61, 0x73, 0x45, // 0x18
+	0x20, 0x21, 0x22, 0x23, 0x3F, 0x25, 0x26, 0x27, // 0x20
+	0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, // 0x28
+	0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, // 0x30
+	0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F, // 0x38
+	0x21, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, // 0x40
+	0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, // 0x48
+	0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, // 0x50
+	0x58, 0x59, 0x5A, 0x41, 0x4F, 0x4E, 0x55, 0x3F, // 0x58
+	0x3F, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, // 0x60
+	0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, // 0x68
+	0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, // 0x70
+	0x78, 0x79, 0x7A, 0x61, 0x6F, 0x6E, 0x75, 0x61 // 0x78
+};
+
+// Semi-octet digits in an address
+static const char addressDigits[] = "0123456789*#abc";
+
+// digitCount([number]) - Returns the number of digits in [number], ignoring
+// a leading '+' and any separators.
+static uint8_t digitCount(const char * number)
+{
+	uint8_t digits = 0;
+	
+	while (*number != '\0')
+	{
+		if ((*number >= '0') && (*number <= '9'))
+			digits++;
+		number++;
+	}
+	return digits;
+}
+
+// putUTF8([c], [dest], [room]) - Write [c] to [dest] as UTF-8, if it fits in
+// [room] bytes. Returns the number of bytes written - 0 if it didn't fit.
+static uint8_t putUTF8(uint32_t c, char * dest, int room)
+{
+	uint8_t bytes = (c < 0x80) ? 1 : (c < 0x800) ? 2 : (c < 0x10000) ? 3 : 4;
+	uint8_t i = 0;
+	
+	if (bytes > room)
+		return 0;
+	if (bytes == 1)
+	{
+		dest[i++] = c;
+	}
+	else
+	{
+		// Lead byte: 110xxxxx, 1110xxxx or 11110xxx
+		dest[i++] = (0xF00 >> bytes) | (c >> (6 * (bytes - 1)));
+		for (; i < bytes; i++)
+			dest[i] = 0x80 | ((c >> (6 * (bytes - 1 - i))) & 0x3F);
+	}
+	return bytes;
+}
+
+MG2639_PDU::MG2639_PDU(MG2639_SMS & modem)
+{
+	_sms = &modem;
+	memset(_sender, 0, MAX_PHONE_NUMBER_SIZE);
+	memset(_scts, 0, 7);
+	_dcs = PDU_DCS_7BIT;
+	_data[0] = 0;
+	_length = 0;
+	_udhLength = 0;
+	_reference = 0;
+	_hex = NULL;
+	_bits = 0;
+	_bitCount = 0;
+}
+
+int MG2639_PDU::send(const char * number, const char * text)
+{
+	return send(number, text, strlen(text), NULL, 0);
+}
+
+int MG2639_PDU::send(const char * number, const char * text, unsigned int length,
+                     const uint8_t * udh, uint8_t udhLength)
+{
+	if (isGSM(text, length))
+		return submit(number, (const uint8_t *) text, length, PDU_DCS_7BIT, udh, udhLength, false);
+	
+	return submit(number, (const uint8_t *) text, length, PDU_DCS_UCS2, udh, udhLength, true);
+}
+
+int MG2639_PDU::send(const char * number, const uint8_t * data, uint8_t length)
+{
+	return send(number, data, length, PDU_DCS_8BIT, NULL, 0);
+}
+
+int MG2639_PDU::send(const char * number, const uint8_t * data, uint8_t length,
+                     pdu_dcs dcs, const uint8_t * udh, uint8_t udhLength)
+{
+	return submit(number, data, length, dcs, udh, udhLength, false);
+}
+
+int MG2639_PDU::submit(const char * number, const uint8_t * data, unsigned int length,
+                       pdu_dcs dcs, const uint8_t * udh, uint8_t udhLength, bool utf8)
+{
+	int iRetVal;
+	char tempCmd[12];
+	unsigned int udl; // User data length: septets (7-bit) or bytes
+	uint8_t udOctets;
+	uint8_t headerSeptets = 0;
+	uint8_t digits = digitCount(number);
+	long reference;
+	
+	if ((digits == 0) || (digits > 20))
+		return ERROR_FAIL_RESPONSE;
+	
+	// With 7-bit text, the UDH is padded out to a whole number of septets
+	if (udhLength > 0)
+		headerSeptets = ((udhLength + 1) * 8 + 6) / 7;
+	if (dcs == PDU_DCS_7BIT)
+	{
+		udl = headerSeptets + septets((const char *) data, length);
+		if (udl > 160)
+			return ERROR_OVERRUN_PREVENT;
+		udOctets = (udl * 7 + 7) / 8;
+	}
+	else
+	{
+		udl = ((udhLength > 0) ? udhLength + 1 : 0) +
+		      (utf8 ? 2 * ucs2Length((const char *) data, length) : length);
+		if (udl > 140)
+			return ERROR_OVERRUN_PREVENT;
+		udOctets = udl;
+	}
+	
+	if (_sms->getMode() != SMS_PDU_MODE)
+	{
+		iRetVal = _sms->setMode(SMS_PDU_MODE);
+		if (iRetVal < 0)
+			return iRetVal;
+	}
+	
+	// AT+CMGS=<length>, not counting the SMSC byte: first octet, reference,
+	// address length and type, address, PID, DCS, validity, UDL, user data.
+	sprintf(tempCmd, "%s=%d", SMS_SEND, 8 + (digits + 1) / 2 + udOctets);
+	_sms->getCell().clearSerial();
+	_sms->getCell().clearBuffer();
+	_sms->getCell().sendATCommand((const char *)tempCmd);
+	iRetVal = _sms->getCell().readWaitForResponses(">", RESPONSE_ERROR,
+	                                               COMMAND_RESPONSE_TIME);
+	if (iRetVal < 0)
+		return iRetVal;
+	
+	writeByte(0x00); // No SMSC - use the one stored on the SIM
+	// SMS-SUBMIT, relative VP, UDHI, and TP-SRR if status reports are on
+	writeByte(((udhLength > 0) ? 0x51 : 0x11) | (_sms->getReports() ? 0x20 : 0));
+	writeByte(0x00); // Message reference, filled in by the module
+	writeAddress(number);
+	writeByte(0x00); // Protocol identifier
+	writeByte(dcs);
+	writeByte(PDU_VALIDITY);
+	writeByte(udl);
+	if (udhLength > 0)
+	{
+		writeByte(udhLength);
+		for (uint8_t i = 0; i < udhLength; i++)
+			writeByte(udh[i]);
+	}
+	if (dcs == PDU_DCS_7BIT)
+	{
+		const char * p = (const char *) data;
+		const char * end = p + length;
+		
+		// Fill bits take the packer up to the next septet boundary
+		_bits = 0;
+		_bitCount = (udhLength > 0) ? headerSeptets * 7 - (udhLength + 1) * 8 : 0;
+		while (p < end)
+		{
+			uint8_t septet = toGSM(nextUTF8(&p, end));
+			if (septet & 0x80)
+				writeSeptet(0x1B);
+			writeSeptet(septet & 0x7F);
+		}
+		if (_bitCount > 0)
+			writeByte(_bits);
+	}
+	else if (utf8)
+	{
+		const char * p = (const char *) data;
+		const char * end = p + length;
+		uint32_t c;
+		
+		// Each character as one or two big-endian 16-bit units
+		while (p < end)
+		{
+			c = nextUTF8(&p, end);
+			if (c > 0xFFFF)
+			{
+				c -= 0x10000;
+				writeByte(0xD8 | (c >> 18));
+				writeByte(c >> 10);
+				c = 0xDC00 | (c & 0x3FF);
+			}
+			writeByte(c >> 8);
+			writeByte(c);
+		}
+	}
+	else
+	{
+		for (unsigned int i = 0; i < length; i++)
+			writeByte(data[i]);
+	}
+	_sms->getCell().printChar(CTRL_Z);
+	
+	// Example response:
+	// +CMGS: 12\r\n
+	// \r\n
+	// OK
+	iRetVal = _sms->getCell().readWaitForResponses("+CMGS: ", RESPONSE_ERROR,
+	                                               SMS_COMMAND_TIMEOUT);
+	if (iRetVal < 0)
+		return iRetVal;
+	reference = _sms->getCell().readNumber('\r', COMMAND_RESPONSE_TIME);
+	if (reference >= 0)
+		_reference = reference;
+	_sms->getCell().readWaitForResponse(RESPONSE_OK, COMMAND_RESPONSE_TIME);
+	
+	return 1;
+}
+
+int MG2639_PDU::read(uint8_t msgIndex)
+{
+	int iRetVal;
+	char tempCmd[10];
+	int c;
+	
+	if (_sms->getMode() != SMS_PDU_MODE)
+	{
+		iRetVal = _sms->setMode(SMS_PDU_MODE);
+		if (iRetVal < 0)
+			return iRetVal;
+	}
+	
+	memset(tempCmd, 0, 10);
+	sprintf(tempCmd, "%s=%d", SMS_READ, msgIndex);
+	_sms->getCell().clearSerial();
+	_sms->getCell().clearBuffer();
+	_sms->getCell().sendATCommand((const char *)tempCmd);
+	
+	// Example response:
+	// +CMGR: 0,,34\r\n
+	// 07913110101010F1040B913130555512F40000620190124521800441E19008\r\n
+	// \r\n
+	// OK
+	iRetVal = _sms->getCell().readWaitForResponses("+CMGR: ", RESPONSE_ERROR,
+	                                               COMMAND_RESPONSE_TIME);
+	if (iRetVal < 0)
+		return iRetVal;
+	while ((c = _sms->getCell().readChar(COMMAND_RESPONSE_TIME)) != '\n')
+	{
+		if (c < 0)
+			return ERROR_TIMEOUT;
+	}
+	
+	_hex = NULL;
+	iRetVal = parse();
+	if (iRetVal < 0)
+	{
+		_length = 0;
+		_data[0] = 0;
+	}
+	
+	// Read through the "OK" - and the rest of the PDU, if it wasn't parsed.
+	_sms->getCell().readWaitForResponse(RESPONSE_OK, COMMAND_RESPONSE_TIME);
+	
+	return iRetVal;
+}
+
+int MG2639_PDU::decode(const char * hex)
+{
+	int iRetVal;
+	
+	_hex = hex;
+	iRetVal = parse();
+	_hex = NULL;
+	if (iRetVal < 0)
+	{
+		_length = 0;
+		_data[0] = 0;
+	}
+	
+	return iRetVal;
+}
+
+void MG2639_PDU::getDate(char * dest)
+{
+	// The time zone's sign is bit 3 of its first digit
+	sprintf(dest, "%02u/%02u/%02u %02u:%02u:%02u%c%02u", bcd(_scts[0]),
+	        bcd(_scts[1]), bcd(_scts[2]), bcd(_scts[3]), bcd(_scts[4]),
+	        bcd(_scts[5]), (_scts[6] & 0x08) ? '-' : '+', bcd(_scts[6] & 0xF7));
+}
+
+int MG2639_PDU::getText(char * dest, int size)
+{
+	int out = 0;
+	uint8_t bytes;
+	uint32_t c;
+	
+	if (_dcs == PDU_DCS_UCS2)
+		return toUTF8(_data, _length, dest, size);
+	
+	if (_dcs == PDU_DCS_8BIT)
+	{
+		out = (_length < size - 1) ? _length : size - 1;
+		memcpy(dest, _data, out);
+		dest[out] = '\0';
+		return out;
+	}
+	
+	for (uint8_t i = 0; i < _length; i++)
+	{
+		// 7-bit text keeps characters that aren't ASCII as 0x80 | septet
+		c = _data[i];
+		if (c & 0x80)
+			c = (c == (0x80 | GSM_EURO)) ? UNICODE_EURO : toUnicode(c & 0x7F);
+		bytes = putUTF8(c, &dest[out], size - 1 - out);
+		if (bytes == 0)
+			break;
+		out += bytes;
+	}
+	dest[out] = '\0';
+	
+	return out;
+}
+
+uint8_t MG2639_PDU::toGSM(uint32_t c)
+{
+	if (c < 0x80)
+		return pgm_read_byte(&asciiToGSM[c]);
+	if (c == UNICODE_EURO)
+		return 0x80 | GSM_EURO;
+	
+	for (uint8_t septet = 0; septet < 128; septet++)
+	{
+		if (pgm_read_word(&gsmToUnicode[septet]) == c)
+			return septet;
+	}
+	return '?';
+}
+
+uint16_t MG2639_PDU::toUnicode(uint8_t septet, bool escaped)
+{
+	septet &= 0x7F;
+	if (!escaped)
+		return pgm_read_word(&gsmToUnicode[septet]);
+	if (septet == GSM_EURO)
+		return UNICODE_EURO;
+	
+	return toASCII(septet, true);
+}
+
+char MG2639_PDU::toASCII(uint8_t septet, bool escaped)
+{
+	septet &= 0x7F;
+	if (!escaped)
+		return pgm_read_byte(&gsmToASCII[septet]);
+	
+	// The extension table is short - find the septet in asciiToGSM.
+	for (uint8_t c = 0; c < 128; c++)
+	{
+		if (pgm_read_byte(&asciiToGSM[c]) == (0x80 | septet))
+			return c;
+	}
+	return '?';
+}
+
+unsigned int MG2639_PDU::septets(const char * text, unsigned int length)
+{
+	const char * end = text + length;
+	unsigned int count = 0;
+	
+	while (text < end)
+		count += (toGSM(nextUTF8(&text, end)) & 0x80) ? 2 : 1;
+	
+	return count;
+}
+
+int MG2639_PDU::parse()
+{
+	int b;
+	int first, addressLength, addressType, udl;
+	uint8_t octets, headerLength = 0;
+	uint8_t i, p = 0;
+	
+	_sender[0] = '\0';
+	_data[0] = 0;
+	_length = 0;
+	_udhLength = 0;
+	
+	// SMSC address - length, then that many bytes
+	b = readByte();
+	if (b < 0)
+		return b;
+	for (i = 0; i < b; i++)
+	{
+		if (readByte() < 0)
+			return ERROR_TIMEOUT;
+	}
+	
+	// First octet. Only SMS-DELIVER (TP-MTI 0) is handled.
+	first = readByte();
+	if (first < 0)
+		return first;
+	if ((first & 0x03) != 0)
+		return ERROR_UNKNOWN_RESPONSE;
+	
+	// Sender - length in digits, type, then the digits (or packed name)
+	addressLength = readByte();
+	addressType = readByte();
+	if ((addressLength < 0) || (addressType < 0))
+		return ERROR_TIMEOUT;
+	octets = (addressLength + 1) / 2;
+	if (octets > 12)
+		return ERROR_UNKNOWN_RESPONSE;
+	for (i = 0; i < octets; i++)
+	{
+		b = readByte();
+		if (b < 0)
+			return b;
+		_data[i] = b;
+	}
+	if ((addressType & 0x70) == 0x50)
+	{	// Alphanumeric, packed like 7-bit text
+		uint8_t count = addressLength * 4 / 7;
+		unpack(count);
+		for (i = 0; (i < count) && (p < MAX_PHONE_NUMBER_SIZE - 1); i++)
+			_sender[p++] = toASCII(_data[i]);
+	}
+	else
+	{
+		if ((addressType & 0x70) == 0x10)
+			_sender[p++] = '+';
+		for (i = 0; (i < addressLength) && (p < MAX_PHONE_NUMBER_SIZE - 1); i++)
+		{
+			b = (i & 1) ? (_data[i >> 1] >> 4) : (_data[i >> 1] & 0x0F);
+			_sender[p++] = addressDigits[(b < 15) ? b : 14];
+		}
+	}
+	_sender[p] = '\0';
+	
+	// Protocol identifier (ignored), coding scheme, timestamp
+	if (readByte() < 0)
+		return ERROR_TIMEOUT;
+	b = readByte();
+	if (b < 0)
+		return b;
+	if ((b & 0x80) == 0) // General data coding groups
+		_dcs = ((b & 0x0C) == 0x0C) ? PDU_DCS_8BIT : (b & 0x0C);
+	else if ((b & 0xF0) == 0xF0) // Data coding/message class
+		_dcs = b & 0x04;
+	else if ((b & 0xF0) == 0xE0) // Message waiting, UCS2
+		_dcs = PDU_DCS_UCS2;
+	else
+		_dcs = PDU_DCS_7BIT;
+	for (i = 0; i < 7; i++)
+	{
+		b = readByte();
+		if (b < 0)
+			return b;
+		_scts[i] = b;
+	}
+	
+	// User data
+	udl = readByte();
+	if (udl < 0)
+		return udl;
+	if (_dcs == PDU_DCS_7BIT)
+	{
+		if (udl > 160)
+			return ERROR_OVERRUN_PREVENT;
+		octets = (udl * 7 + 7) / 8;
+	}
+	else
+	{
+		if (udl > 140)
+			return ERROR_OVERRUN_PREVENT;
+		octets = udl;
+	}
+	for (i = 0; i < octets; i++)
+	{
+		b = readByte();
+		if (b < 0)
+			return b;
+		_data[i] = b;
+	}
+	
+	if (first & 0x40)
+	{	// User data header, after its length (UDHL)
+		headerLength = _data[0] + 1;
+		if (headerLength > octets)
+			return ERROR_UNKNOWN_RESPONSE;
+		_udhLength = (_data[0] < PDU_UDH_SIZE) ? _data[0] : PDU_UDH_SIZE;
+		memcpy(_udh, &_data[1], _udhLength);
+	}
+	
+	if (_dcs == PDU_DCS_7BIT)
+	{
+		bool escaped = false;
+	
+		// Unpack, then skip the septets the header (and fill bits) took.
+		// Characters are written behind the ones being read.
+		unpack(udl);
+		for (i = (headerLength * 8 + 6) / 7; i < udl; i++)
+		{
+			uint16_t c;
+			
+			if ((_data[i] == 0x1B) && !escaped)
+			{
+				escaped = true;
+				continue;
+			}
+			// ASCII as is, other characters as 0x80 | septet - the euro sign
+			// takes the place of 'e', which is ASCII.
+			c = toUnicode(_data[i], escaped);
+			if (c < 0x80)
+				_data[_length++] = c;
+			else
+				_data[_length++] = 0x80 | ((c == UNICODE_EURO) ? GSM_EURO : _data[i]);
+			escaped = false;
+		}
+	}
+	else
+	{
+		_length = octets - headerLength;
+		memmove(_data, &_data[headerLength], _length);
+	}
+	_data[_length] = 0;
+	
+	return _length;
+}
+
+int MG2639_PDU::readByte()
+{
+	uint8_t value = 0;
+	int c;
+	
+	for (uint8_t i = 0; i < 2; i++)
+	{
+		if (_hex != NULL)
+		{
+			c = *_hex;
+			if (c != '\0')
+				_hex++;
+		}
+		else
+		{
+			c = _sms->getCell().readChar(COMMAND_RESPONSE_TIME);
+			if (c < 0)
+				return ERROR_TIMEOUT;
+		}
+	
+		value <<= 4;
+		if ((c >= '0') && (c <= '9'))
+			value |= c - '0';
+		else if ((c >= 'A') && (c <= 'F'))
+			value |= c - 'A' + 10;
+		else if ((c >= 'a') && (c <= 'f'))
+			value |= c - 'a' + 10;
+		else
+			return ERROR_UNKNOWN_RESPONSE;
+	}
+	
+	return value;
+}
+
+void MG2639_PDU::writeByte(uint8_t b)
+{
+	static const char hexDigits[] = "0123456789ABCDEF";
+	char hex[2];
+	
+	hex[0] = hexDigits[b >> 4];
+	hex[1] = hexDigits[b & 0x0F];
+	_sms->getCell().printString(hex, 2);
+}
+
+void MG2639_PDU::writeSeptet(uint8_t s)
+{
+	_bits |= (uint16_t) s << _bitCount;
+	_bitCount += 7;
+	if (_bitCount >= 8)
+	{
+		writeByte(_bits & 0xFF);
+		_bits >>= 8;
+		_bitCount -= 8;
+	}
+}
+
+void MG2639_PDU::writeAddress(const char * number)
+{
+	uint8_t low = 0;
+	bool half = false;
+	
+	writeByte(digitCount(number));
+	writeByte((number[0] == '+') ? 0x91 : 0x81); // International or unknown
+	
+	// Two digits per byte, first digit in the low nibble, 0xF to pad
+	for (; *number != '\0'; number++)
+	{
+		if ((*number < '0') || (*number > '9'))
+			continue;
+		if (!half)
+		{
+			low = *number - '0';
+		}
+		else
+		{
+			writeByte(low | ((*number - '0') << 4));
+		}
+		half = !half;
+	}
+	if (half)
+		writeByte(low | 0xF0);
+}
+
+void MG2639_PDU::unpack(uint8_t count)
+{
+	// Work back from the end, so no septet overwrites a byte still to be
+	// read: septet i never needs a byte past i - 1.
+	for (int i = count - 1; i >= 0; i--)
+	{
+		unsigned int bit = i * 7;
+		uint8_t shift = bit & 7;
+		uint8_t septet = _data[bit >> 3] >> shift;
+	
+		if (shift > 1)
+			septet |= _data[(bit >> 3) + 1] << (8 - shift);
+		_data[i] = septet & 0x7F;
+	}
+}
+
+uint8_t MG2639_PDU::bcd(uint8_t b)
+{
+	return (b & 0x0F) * 10 + (b >> 4);
+}
+
+bool MG2639_PDU::isGSM(const char * text, unsigned int length)
+{
+	const char * end = text + length;
+	uint32_t c;
+	
+	while (text < end)
+	{
+		c = nextUTF8(&text, end);
+		if ((toGSM(c) == '?') && (c != '?'))
+			return false;
+	}
+	return true;
+}
+
+uint32_t MG2639_PDU::nextUTF8(const char ** text, const char * end)
+{
+	const uint8_t * p = (const uint8_t *) *text;
+	uint32_t c = *p++;
+	uint8_t more;
+	
+	if (c < 0x80)
+		more = 0;
+	else if ((c & 0xE0) == 0xC0)
+		more = 1;
+	else if ((c & 0xF0) == 0xE0)
+		more = 2;
+	else if ((c & 0xF8) == 0xF0)
+		more = 3;
+	else
+		more = 0xFF; // A continuation byte, out of place
+	
+	if (more == 0xFF)
+	{
+		c = '?';
+	}
+	else
+	{
+		c &= 0x7F >> more;
+		while (more-- > 0)
+		{
+			if ((p == (const uint8_t *) end) || ((*p & 0xC0) != 0x80))
+			{
+				c = '?';
+				break;
+			}
+			c = (c << 6) | (*p++ & 0x3F);
+		}
+	}
+	*text = (const char *) p;
+	
+	// Surrogates are only for UCS2 itself
+	if ((c > 0x10FFFF) || ((c >= 0xD800) && (c <= 0xDFFF)))
+		c = '?';
+	return c;
+}
+
+unsigned int MG2639_PDU::ucs2Length(const char * text, unsigned int length)
+{
+	const char * end = text + length;
+	unsigned int units = 0;
+	
+	while (text < end)
+		units += (nextUTF8(&text, end) > 0xFFFF) ? 2 : 1;
+	return units;
+}
+
+int MG2639_PDU::toUTF8(const uint8_t * ucs2, uint8_t length, char * dest, int size)
+{
+	int out = 0;
+	uint32_t c;
+	uint8_t bytes;
+	
+	for (uint8_t i = 0; i + 1 < length; i += 2)
+	{
+		c = ((uint16_t) ucs2[i] << 8) | ucs2[i + 1];
+		if ((c >= 0xD800) && (c <= 0xDBFF) && (i + 3 < length) &&
+		    ((ucs2[i + 2] & 0xFC) == 0xDC))
+		{
+			// Surrogate pair
+			c = 0x10000 + ((c & 0x3FF) << 10) +
+			    ((((uint16_t) ucs2[i + 2] << 8) | ucs2[i + 3]) & 0x3FF);
+			i += 2;
+		}
+		else if ((c >= 0xD800) && (c <= 0xDFFF))
+		{
+			c = '?';
+		}
+		
+		bytes = putUTF8(c, &dest[out], size - 1 - out);
+		if (bytes == 0)
+			break;
+		out += bytes;
+	}
+	dest[out] = '\0';
+	
+	return out;
+}
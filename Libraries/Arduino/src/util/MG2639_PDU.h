@@ -0,0 +1,285 @@
+/******************************************************************************
+MG2639_PDU.h
+MG2639 Cellular Shield Library - PDU-Mode SMS Header
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines a PDU-mode SMS codec.
+MG2639_PDU, a friend class of MG2639_Cell, builds SMS-SUBMIT PDUs and parses
+SMS-DELIVER PDUs itself, instead of leaving it to the module's text mode. It
+switches the module to PDU mode (sms.setMode(SMS_PDU_MODE)) when needed - call
+sms.setMode(SMS_TEXT_MODE) before going back to sms.read() or MG2639_Inbox.
+
+e.g.:	MG2639_PDU pdu;
+		pdu.send("+13035551234", "Hello @ 160 chars");
+		pdu.send("+13035551234", "¿Qué tal, señor?"); // Still 7-bit
+		pdu.send("+13035551234", "¿Qué tal? 你好"); // Sent as UCS2
+		uint8_t reading[4] = {1, 2, 3, 4};
+		pdu.send("+13035551234", reading, 4); // 8-bit binary
+
+Text is UTF-8, packed into GSM 03.38 7-bit septets through tables in
+PROGMEM. The GSM alphabet has the accented letters of most western European
+languages (é, ñ, ü, ¿, ¡, Ñ, Ü...), so Spanish or French text usually stays
+7-bit. [, ], {, }, \, ^, |, ~ and € are sent as two-septet escapes. Sending
+is streamed to the module as it's packed. Text with any character outside
+the GSM alphabet (á, í, 中, or an ASCII one like `) is sent as UCS2
+instead, streamed straight from UTF-8 - no buffer is needed either way.
+Received PDUs are read into one PDU_DATA_SIZE byte buffer and unpacked in
+place. A User Data Header (UDH), if any, is kept separately - see getUDH().
+
+What fits in one message:
+
+	                  | Text mode | PDU 7-bit | PDU 8-bit | PDU UCS2
+	------------------+-----------+-----------+-----------+----------
+	Payload           | 160 chars*| 160 chars | 140 bytes | 70 chars
+	With a 5-byte UDH | -         | 153 chars | 134 bytes | 67 chars
+	Binary, 0x00, 0x1A| No        | No        | Yes       | No
+	UART characters to| ~160      | ~310      | ~310      | ~310
+	send a full message
+
+* Text mode leaves the character set to the module - '@' (septet 0x00)
+and Ctrl+Z can't be sent, and the module's charset setting changes what
+arrives. PDU mode sends twice as many UART characters (hex), ~0.3 s at 9600
+baud.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#ifndef _MG2639_PDU_H_
+#define _MG2639_PDU_H_
+
+#include <Arduino.h>
+#include "MG2639_SMS.h"
+
+// PDU_DATA_SIZE - Size of the receive buffer: 160 unpacked septets and a
+// 0-terminator. Raw user data (up to 140 bytes) is read into the same buffer.
+#define PDU_DATA_SIZE 161
+
+// PDU_UDH_SIZE - Longest User Data Header kept by read(). Longer headers
+// are cut.
+#define PDU_UDH_SIZE 16
+
+// PDU_VALIDITY - Validity period sent with each message (relative format).
+// 0xA7 is 24 hours.
+#define PDU_VALIDITY 0xA7
+
+// pdu_dcs enumerates the data coding schemes (TP-DCS) the codec handles:
+// 0x00: PDU_DCS_7BIT - GSM 03.38 default alphabet, 160 characters
+// 0x04: PDU_DCS_8BIT - Binary, 140 bytes
+// 0x08: PDU_DCS_UCS2 - 16-bit characters, 70 characters (passed as bytes)
+enum pdu_dcs {
+	PDU_DCS_7BIT = 0x00,
+	PDU_DCS_8BIT = 0x04,
+	PDU_DCS_UCS2 = 0x08
+};
+
+class MG2639_PDU
+{
+public:
+	/// MG2639_PDU([modem]) - Constructor
+	/// Sets up class variables. Messages go through [modem] - the global sms
+	/// if it's left out.
+	MG2639_PDU(MG2639_SMS & modem = sms);
+	
+	/// getSMS() - Returns the modem messages go through.
+	inline MG2639_SMS & getSMS() { return *_sms; };
+	
+	/////////////
+	// Sending //
+	/////////////
+	
+	/// send([number], [text]) - Send UTF-8 [text] to [number] - as GSM
+	/// 7-bit if every character is in the GSM alphabet, otherwise as UCS2.
+	/// [number] starting with '+' is sent as an international number.
+	///
+	/// Returns: >0 on success, <0 on fail (ERROR_OVERRUN_PREVENT if [text]
+	/// doesn't fit in one message).
+	int send(const char * number, const char * text);
+	
+	/// send([number], [text], [length], [udh], [udhLength]) - Send [length]
+	/// bytes of UTF-8 [text] with a User Data Header, choosing 7-bit or UCS2
+	/// as send([number], [text]) does.
+	///
+	/// Returns: >0 on success, <0 on fail.
+	int send(const char * number, const char * text, unsigned int length,
+	         const uint8_t * udh, uint8_t udhLength);
+	
+	/// send([number], [data], [length]) - Send [length] bytes of binary
+	/// [data] to [number], as 8-bit.
+	///
+	/// Returns: >0 on success, <0 on fail (ERROR_OVERRUN_PREVENT if [length]
+	/// is over 140).
+	int send(const char * number, const uint8_t * data, uint8_t length);
+	
+	/// send([number], [data], [length], [dcs], [udh], [udhLength]) - Send a
+	/// message with a User Data Header. [udh] is the header's information
+	/// elements, without the UDHL byte in front. With PDU_DCS_7BIT, [data]
+	/// is UTF-8 text and [length] its length in bytes.
+	///
+	/// Returns: >0 on success, <0 on fail.
+	int send(const char * number, const uint8_t * data, uint8_t length,
+	         pdu_dcs dcs, const uint8_t * udh, uint8_t udhLength);
+	
+	/// getReference() - Returns the message reference the network gave the
+	/// last message sent (TP-MR, from "+CMGS: ").
+	inline uint8_t getReference() { return _reference; };
+	
+	/////////////
+	// Reading //
+	/////////////
+	
+	/// read([msgIndex]) - Read and decode the SMS-DELIVER PDU at
+	/// [msgIndex]. Use sms.available() to find an index.
+	///
+	/// Returns: >=0 (length from getData()) on success, <0 on fail
+	/// (ERROR_UNKNOWN_RESPONSE if it isn't an SMS-DELIVER PDU).
+	int read(uint8_t msgIndex);
+	
+	/// decode([hex]) - Decode an SMS-DELIVER PDU from a hex string, e.g. one
+	/// saved earlier. [hex] starts with the SMSC length, as read from the
+	/// module.
+	///
+	/// Returns: >=0 (length from getData()) on success, <0 on fail.
+	int decode(const char * hex);
+	
+	/// getSender() - Returns the sender's number (or alphanumeric name) of
+	/// the last message decoded.
+	inline const char * getSender() { return _sender; };
+	
+	/// getDate([dest]) - Write the service centre timestamp of the last
+	/// message decoded to [dest], as "yy/MM/dd hh:mm:ss+zz" (zz in quarter
+	/// hours). [dest] must have room for 21 characters.
+	void getDate(char * dest);
+	
+	/// getDCS() - Returns the data coding scheme of the last message decoded.
+	/// Message classes and other bits are masked off, leaving a pdu_dcs.
+	inline pdu_dcs getDCS() { return (pdu_dcs) _dcs; };
+	
+	/// getData() - Returns the user data of the last message decoded. 7-bit
+	/// text is 0-terminated, one byte per character: ASCII characters as
+	/// they are, other GSM characters (é, ñ, £, Δ...) as 0x80 | their septet
+	/// - toASCII() gives the closest ASCII letter. The euro sign, from the
+	/// extension table, is 0xE5. 8-bit and UCS2 data is returned as is. See
+	/// getText() for UTF-8.
+	inline const uint8_t * getData() { return _data; };
+	
+	/// getText([dest], [size]) - Write the text of the last message decoded
+	/// to [dest] as UTF-8, converting it from 7-bit or UCS2. It's cut, at a
+	/// character boundary, to fit [size] - 1 bytes, and 0-terminated. A full
+	/// 7-bit message can take 320 bytes (accented letters take 2 bytes), a
+	/// full UCS2 one 211 (Chinese, 3 bytes a character).
+	///
+	/// Returns: Length written to [dest].
+	int getText(char * dest, int size);
+	
+	/// getLength() - Returns the number of characters (7-bit) or bytes in
+	/// getData().
+	inline uint8_t getLength() { return _length; };
+	
+	/// getUDH() and getUDHLength() - Return the User Data Header of the last
+	/// message decoded (without the UDHL byte), or a length of 0 if it had
+	/// none.
+	inline const uint8_t * getUDH() { return _udh; };
+	inline uint8_t getUDHLength() { return _udhLength; };
+	
+	///////////////////////
+	// Character Mapping //
+	///////////////////////
+	
+	/// toGSM([c]) - Returns the GSM 03.38 septet for Unicode character [c]
+	/// (e.g. from nextUTF8()). Characters in the extension table come back as
+	/// 0x80 | septet - send 0x1B first. Characters with no GSM equivalent
+	/// come back as '?'.
+	static uint8_t toGSM(uint32_t c);
+	
+	/// toUnicode([septet], [escaped]) - Returns the Unicode character for a
+	/// GSM 03.38 septet - from the extension table if [escaped].
+	static uint16_t toUnicode(uint8_t septet, bool escaped = false);
+	
+	/// toASCII([septet], [escaped]) - Returns the ASCII character for a GSM
+	/// 03.38 septet - from the extension table if [escaped] (it followed a
+	/// 0x1B).
+	static char toASCII(uint8_t septet, bool escaped = false);
+	
+	/// septets([text], [length]) - Returns the number of septets [length]
+	/// bytes of UTF-8 [text] take as GSM 7-bit, counting escapes.
+	static unsigned int septets(const char * text, unsigned int length);
+	
+	/// isGSM([text], [length]) - Returns true if every character of UTF-8
+	/// [text] is in the GSM 7-bit alphabet: ASCII (less ` and a few
+	/// others), the Latin letters é, è, ñ, ü, ç, å, ø... and ¿, ¡, £, €.
+	static bool isGSM(const char * text, unsigned int length);
+	
+	/// nextUTF8([text], [end]) - Decode one character of UTF-8 from [text],
+	/// moving it past the character. Bad sequences come back as '?'.
+	/// Returns: The character's code point.
+	static uint32_t nextUTF8(const char ** text, const char * end);
+	
+	/// ucs2Length([text], [length]) - Returns the number of 16-bit UCS2
+	/// units [length] bytes of UTF-8 [text] take. Characters past U+FFFF,
+	/// like emoji, take two (a surrogate pair).
+	static unsigned int ucs2Length(const char * text, unsigned int length);
+	
+	/// toUTF8([ucs2], [length], [dest], [size]) - Convert [length] bytes of
+	/// UCS2 (big-endian, as received) to UTF-8, as getText() does.
+	/// Returns: Length written to [dest].
+	static int toUTF8(const uint8_t * ucs2, uint8_t length, char * dest, int size);
+
+private:
+	MG2639_SMS * _sms;
+	char _sender[MAX_PHONE_NUMBER_SIZE];
+	uint8_t _scts[7]; // Timestamp, as received (swapped BCD)
+	uint8_t _dcs;
+	uint8_t _data[PDU_DATA_SIZE];
+	uint8_t _length;
+	uint8_t _udh[PDU_UDH_SIZE];
+	uint8_t _udhLength;
+	uint8_t _reference;
+	
+	// Source of decode()'s hex - a string, or the UART if NULL
+	const char * _hex;
+	
+	// Septet packer state, for sending
+	uint16_t _bits;
+	uint8_t _bitCount;
+	
+	/// submit([number], [data], [length], [dcs], [udh], [udhLength],
+	/// [utf8]) - Build and send an SMS-SUBMIT PDU. If [utf8], [data] is UTF-8
+	/// text, converted to UCS2 as it's sent.
+	/// Returns: >0 on success, <0 on fail.
+	int submit(const char * number, const uint8_t * data, unsigned int length,
+	           pdu_dcs dcs, const uint8_t * udh, uint8_t udhLength, bool utf8);
+	
+	/// parse() - Decode an SMS-DELIVER PDU from _hex (or the UART).
+	/// Returns: >=0 (length of getData()) on success, <0 on fail.
+	int parse();
+	
+	/// readByte() - Read two hex characters from _hex (or the UART).
+	/// Returns: The byte, or <0 if it timed out or wasn't hex.
+	int readByte();
+	
+	/// writeByte([b]) - Send [b] to the module as two hex characters.
+	void writeByte(uint8_t b);
+	
+	/// writeSeptet([s]) - Pack a septet, sending each byte as it fills.
+	void writeSeptet(uint8_t s);
+	
+	/// writeAddress([number]) - Send TP-DA: length, type, swapped BCD.
+	void writeAddress(const char * number);
+	
+	/// unpack([count]) - Unpack [count] septets in _data, in place.
+	void unpack(uint8_t count);
+	
+	/// bcd([b]) - Returns the value of a swapped-BCD byte (0x21 is 12).
+	static uint8_t bcd(uint8_t b);
+};
+
+#endif
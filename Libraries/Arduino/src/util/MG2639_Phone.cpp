@@ -24,12 +24,33 @@ Distributed as-is; no warranty is given.
 #include "MG2639_AT.h"
 #include <SFE_MG2639_CellShield.h>
 
-#define CELL_RING	A0	// Cellular module's RING output goes to Arduino's A0
 #define CELL_RING_THRESHOLD 100
 
-MG2639_Phone::MG2639_Phone()
+// Longest URC line poll() keeps, e.g.:
+// +CLCC: 1,0,3,0,0,"13035551234",129
+#define CALL_LINE_SIZE 40
+
+MG2639_Phone * MG2639_Phone::_ringPhones[PHONE_RING_SLOTS] = {NULL, NULL};
+
+MG2639_Phone::MG2639_Phone(MG2639_Cell & modem, uint8_t ringPin)
 {
-	pinMode(CELL_RING, INPUT); // Set CELL_RING pin as an input
+	_cell = &modem;
+	_ringPin = ringPin;
+	pinMode(_ringPin, INPUT); // Set the RING pin as an input
+	_number[0] = '\0';
+	_state = ERROR_FAIL_RESPONSE;
+	_announced = true;
+	_callerID = false;
+	_answered = false;
+	_hungUp = false;
+	_start = 0;
+	_latency = 0;
+	_lastRing = 0;
+	_edgesSeen = 0;
+	_ringEdges = 0;
+	_ringEdge = 0;
+	_dtmfTail = 0;
+	_dtmfCount = 0;
 }
 
 // Check if a call is coming in.
@@ -40,7 +61,7 @@ bool MG2639_Phone::available()
 	// The CELL_RING pin will pull low if a call is coming in.
 	// Otherwise it'll idle at around 2.8V.
 	// Use an analog read because the idle voltage is in a grey logic area.
-	int ringer = analogRead(CELL_RING);
+	int ringer = analogRead(_ringPin);
 	if (ringer < CELL_RING_THRESHOLD)
 		return true;
 	else
@@ -57,16 +78,16 @@ int8_t MG2639_Phone::status()
 	// Originated Ringing e.g.:	+CLCC: 1,0,3,0,0,"12345678901",129\r\n\r\nOK\r\n\r\n
 	// Incoming:				+CLCC: 1,1,4,0,0,"2345678901",129\r\n\r\nOK\r\n\r\n
 	// Active e.g.:				+CLCC: 1,0,0,0,0,"12345678901",129\r\n\r\nOK\r\n\r\n
-	cell.sendATCommand(CHECK_STATUS);
+	_cell->sendATCommand(CHECK_STATUS);
 	// Check for response "OK" is a "fail" -- there is no active call, incoming our outgoing.
 	// Good response will start with "+CLCC"
-	iRetVal = cell.readWaitForResponses(CHECK_STATUS, RESPONSE_OK, COMMAND_RESPONSE_TIME);
+	iRetVal = _cell->readWaitForResponses(CHECK_STATUS, RESPONSE_OK, COMMAND_RESPONSE_TIME);
 	if (iRetVal <= 0)
 	{
 		return iRetVal;
 	}
 	// Now wait for an OK, following the +CLCC info string
-	iRetVal = cell.readWaitForResponse(RESPONSE_OK, COMMAND_RESPONSE_TIME);
+	iRetVal = _cell->readWaitForResponse(RESPONSE_OK, COMMAND_RESPONSE_TIME);
 	if (iRetVal <= 0)
 	{	// This may return a timeout error:
 		return iRetVal;
@@ -76,7 +97,7 @@ int8_t MG2639_Phone::status()
 	char * start;
 	char * end;
 	// Find the first instance of the comma:
-	ptr = strchr((const char *)cell.rxBuffer, ',');
+	ptr = strchr((const char *)_cell->rxBuffer, ',');
 	if (ptr == NULL)
 		return ERROR_FAIL_RESPONSE;
 	start = strchr(ptr + 1, ',');
@@ -100,7 +121,7 @@ int8_t MG2639_Phone::callerID(char * phoneNumber)
 		char * start;
 		char * end;
 		// Find the first instance of the ":
-		start = strchr((const char *)cell.rxBuffer, '\"');
+		start = strchr((const char *)_cell->rxBuffer, '\"');
 		if (start == NULL)
 			return ERROR_FAIL_RESPONSE;
 		end = strchr(start + 1, '\"');
@@ -122,10 +143,12 @@ int8_t MG2639_Phone::answer()
 {
 	int8_t iRetVal;
 	
-	cell.sendATCommand(ANSWER); // Send "ATA"
+	_cell->sendATCommand(ANSWER); // Send "ATA"
 	
 	// "OK" response on successful pick up.
-	iRetVal = cell.readWaitForResponse(RESPONSE_OK, COMMAND_RESPONSE_TIME);
+	iRetVal = _cell->readWaitForResponse(RESPONSE_OK, COMMAND_RESPONSE_TIME);
+	if (iRetVal > 0)
+		_answered = true; // Passed on by the next poll()
 	return iRetVal;
 }
 
@@ -133,10 +156,12 @@ int8_t MG2639_Phone::hangUp()
 {
 	int8_t iRetVal;
 	
-	cell.sendATCommand(HANG_UP); // Send "ATH"
+	_cell->sendATCommand(HANG_UP); // Send "ATH"
 	
 	// "OK" response on successful hang up.
-	iRetVal = cell.readWaitForResponse(RESPONSE_OK, COMMAND_RESPONSE_TIME);
+	iRetVal = _cell->readWaitForResponse(RESPONSE_OK, COMMAND_RESPONSE_TIME);
+	if (iRetVal > 0)
+		_hungUp = true; // Passed on by the next poll()
 	return iRetVal;
 }
 
@@ -149,21 +174,95 @@ int8_t MG2639_Phone::dial(char * phoneNumber)
 	
 	// Send something like: "ATD13024540756;"
 	sprintf(temp, "%s%s;", DIAL, phoneNumber);
-	cell.sendATCommand(temp);
+	_cell->sendATCommand(temp);
 	
 	// Successful response is "OK"
-	iRetVal = cell.readWaitForResponse(RESPONSE_OK, COMMAND_RESPONSE_TIME);
+	iRetVal = _cell->readWaitForResponse(RESPONSE_OK, COMMAND_RESPONSE_TIME);
+	if (iRetVal > 0)
+	{
+		strncpy(_number, phoneNumber, MAX_PHONE_NUMBER_SIZE - 1);
+		_number[MAX_PHONE_NUMBER_SIZE - 1] = '\0';
+		_state = CALL_DIALING;
+		_announced = true;
+		_start = millis();
+		_lastRing = _start;
+		_dtmfCount = 0;
+	}
 	return iRetVal;
 }
 
 int8_t MG2639_Phone::dialLast()
 {	
 	int8_t iRetVal;
-	cell.sendATCommand(DIAL_LAST); // Send "ATDL"
-	iRetVal = cell.readWaitForResponse(RESPONSE_OK, COMMAND_RESPONSE_TIME);
+	_cell->sendATCommand(DIAL_LAST); // Send "ATDL"
+	iRetVal = _cell->readWaitForResponse(RESPONSE_OK, COMMAND_RESPONSE_TIME);
+	if (iRetVal > 0)
+	{
+		_number[0] = '\0';
+		_state = CALL_DIALING;
+		_announced = true;
+		_start = millis();
+		_lastRing = _start;
+		_dtmfCount = 0;
+	}
 	return iRetVal;
 }
 
+int8_t MG2639_Phone::hold(uint8_t n)
+{
+	int8_t iRetVal;
+	char temp[10];
+	memset(temp, 0, 10);
+	
+	// Send a command like: "AT+CHLD=2"
+	sprintf(temp, "%s=%d", HOLD_CALL, n);
+	_cell->sendATCommand(temp);
+	iRetVal = _cell->readWaitForResponse(RESPONSE_OK, COMMAND_RESPONSE_TIME);
+	// With one call, 2 swaps it between active and held
+	if ((iRetVal > 0) && (n == 2))
+	{
+		if (_state == CALL_ACTIVE)
+			_state = CALL_HOLD;
+		else if (_state == CALL_HOLD)
+			_state = CALL_ACTIVE;
+	}
+	return iRetVal;
+}
+
+int8_t MG2639_Phone::sendDTMF(const char * digits)
+{
+	int8_t iRetVal = ERROR_FAIL_RESPONSE;
+	char temp[8];
+	
+	// +VTS takes one tone per command, so send each digit in turn, like:
+	// "AT+VTS=1", "AT+VTS=2", "AT+VTS=#"
+	for (; *digits != '\0'; digits++)
+	{
+		memset(temp, 0, 8);
+		sprintf(temp, "%s=%c", SEND_DTMF, *digits);
+		_cell->sendATCommand(temp);
+		// The tone takes ~100 ms to play before "OK"
+		iRetVal = _cell->readWaitForResponses(RESPONSE_OK, RESPONSE_ERROR,
+		                                      COMMAND_RESPONSE_TIME + DTMF_TONE_TIME);
+		if (iRetVal <= 0)
+			return iRetVal;
+	}
+	return iRetVal;
+}
+
+int MG2639_Phone::readDTMF()
+{
+	char c;
+	
+	if (_dtmfCount == 0)
+		return -1;
+	
+	c = _dtmf[_dtmfTail];
+	_dtmfTail = (_dtmfTail + 1) % PHONE_DTMF_SIZE;
+	_dtmfCount--;
+	return c;
+}
+
 int8_t MG2639_Phone::setAudioChannel(audio_channel channel)
 {
 	int8_t iRetVal;
@@ -172,9 +271,281 @@ int8_t MG2639_Phone::setAudioChannel(audio_channel channel)
 	
 	// Send a commmand like: "AT+SPEAKER=0"
 	sprintf(temp, "%s=%d", SPEAKER_SELECT, channel);
-	cell.sendATCommand(temp);
-	iRetVal = cell.readWaitForResponse(RESPONSE_OK, COMMAND_RESPONSE_TIME);
+	_cell->sendATCommand(temp);
+	iRetVal = _cell->readWaitForResponse(RESPONSE_OK, COMMAND_RESPONSE_TIME);
 	return iRetVal;
 }
 
+int8_t MG2639_Phone::enableCallerID(bool enable)
+{
+	int8_t iRetVal;
+	char temp[10];
+	memset(temp, 0, 10);
+	
+	// Send a command like: "AT+CLIP=1"
+	sprintf(temp, "%s=%d", CALLER_ID, enable ? 1 : 0);
+	_cell->sendATCommand(temp);
+	iRetVal = _cell->readWaitForResponse(RESPONSE_OK, COMMAND_RESPONSE_TIME);
+	if (iRetVal > 0)
+		_callerID = enable;
+	return iRetVal;
+}
+
+int8_t MG2639_Phone::attachRing(uint8_t pin)
+{
+	void (* const handlers[PHONE_RING_SLOTS])() = {ringISR0, ringISR1};
+	int interrupt = digitalPinToInterrupt(pin);
+	uint8_t slot;
+	
+	if (interrupt == NOT_AN_INTERRUPT)
+		return ERROR_FAIL_RESPONSE;
+	
+	// attachInterrupt() can't pass the phone to its handler, so each phone
+	// gets a handler of its own.
+	for (slot = 0; slot < PHONE_RING_SLOTS; slot++)
+	{
+		if ((_ringPhones[slot] == NULL) || (_ringPhones[slot] == this))
+			break;
+	}
+	if (slot == PHONE_RING_SLOTS)
+		return ERROR_OVERRUN_PREVENT;
+	_ringPhones[slot] = this;
+	
+	// RING idles at 2.8V and is pulled low while the phone rings
+	pinMode(pin, INPUT);
+	attachInterrupt(interrupt, handlers[slot], FALLING);
+	return SUCCESS_OK;
+}
+
+int MG2639_Phone::poll(call_event_fn fn)
+{
+	int events = 0;
+	char line[CALL_LINE_SIZE];
+	uint8_t edges;
+	unsigned long edge;
+	
+	// Ring edges keep an incoming call ringing, even if a RING is missed
+	noInterrupts();
+	edges = _ringEdges;
+	edge = _ringEdge;
+	interrupts();
+	if ((edges != _edgesSeen) && (_state == CALL_INCOMING))
+		_lastRing = edge;
+	
+	// Unsolicited results, e.g.:
+	// RING\r\n
+	// +CLIP: "13035551234",129,,,,0\r\n
+	// NO CARRIER\r\n
+	while (_cell->dataAvailable())
+	{
+		if (readLine(line, sizeof(line)) < 0)
+			break;
+		
+		if (strcmp(line, "RING") == 0)
+		{
+			ring(millis());
+		}
+		else if (strncmp(line, "+CLIP: ", 7) == 0)
+		{
+			ring(millis());
+			setNumber(line);
+		}
+		else if (strncmp(line, "+CLCC: ", 7) == 0)
+		{
+			// +CLCC: <id>,<dir>,<stat>,... - the state is after the 2nd comma
+			char * ptr = strchr(line, ',');
+			if (ptr != NULL)
+				ptr = strchr(ptr + 1, ',');
+			if ((ptr != NULL) && (ptr[1] >= '0') && (ptr[1] <= '5'))
+			{
+				events += update(ptr[1] - '0', fn);
+				if (_number[0] == '\0')
+					setNumber(line);
+			}
+		}
+		else if ((strncmp(line, "+DTMF:", 6) == 0) || (strncmp(line, "+ZDTMF:", 7) == 0))
+		{
+			// +DTMF: 5 - one digit from the other end. Unverified: the AT
+			// manuals don't document a detection report, so these lines
+			// may never come.
+			char * ptr = strchr(line, ':') + 1;
+			while (*ptr == ' ')
+				ptr++;
+			if ((*ptr != '\0') && (strchr("0123456789*#ABCD", *ptr) != NULL) &&
+			    (_dtmfCount < PHONE_DTMF_SIZE))
+			{
+				_dtmf[(_dtmfTail + _dtmfCount) % PHONE_DTMF_SIZE] = *ptr;
+				_dtmfCount++;
+			}
+		}
+		else if ((strcmp(line, "NO CARRIER") == 0) || (strcmp(line, "BUSY") == 0) ||
+		         (strcmp(line, "NO ANSWER") == 0))
+		{
+			events += update(ERROR_FAIL_RESPONSE, fn);
+		}
+	}
+	_edgesSeen = edges;
+	
+	// Calls answered or hung up from here
+	if (_answered)
+	{
+		_answered = false;
+		events += update(CALL_ACTIVE, fn);
+	}
+	if (_hungUp)
+	{
+		_hungUp = false;
+		events += update(ERROR_FAIL_RESPONSE, fn);
+	}
+	
+	if (_state == CALL_INCOMING)
+	{
+		// With caller ID on, wait a moment for the caller's number
+		if (!_announced && (!_callerID || (_number[0] != '\0') ||
+		                    (millis() - _start >= CALL_CLIP_WAIT)))
+			events += announce(fn);
+		// The caller gave up, or it went to voicemail
+		if (millis() - _lastRing > CALL_RING_TIMEOUT)
+			events += update(ERROR_FAIL_RESPONSE, fn);
+	}
+	else if (((_state == CALL_DIALING) || (_state == CALL_DIALED_RINGING)) &&
+	         (millis() - _lastRing >= CALL_STATUS_INTERVAL))
+	{
+		// Nothing is sent when the other end picks up - ask.
+		int8_t state = status();
+		_lastRing = millis();
+		if ((state >= 0) || (state == ERROR_FAIL_RESPONSE))
+			events += update(state, fn);
+	}
+	
+	return events;
+}
+
+void MG2639_Phone::ringISR0()
+{
+	_ringPhones[0]->ringEdge();
+}
+
+void MG2639_Phone::ringISR1()
+{
+	_ringPhones[1]->ringEdge();
+}
+
+void MG2639_Phone::ringEdge()
+{
+	unsigned long now = millis();
+	
+	if ((_ringEdges == 0) || (now - _ringEdge >= CALL_RING_DEBOUNCE))
+	{
+		_ringEdge = now;
+		_ringEdges++;
+	}
+}
+
+void MG2639_Phone::ring(unsigned long time)
+{
+	if (_state == ERROR_FAIL_RESPONSE)
+	{
+		// Time the call from the ring's edge, if attachRing() caught it
+		noInterrupts();
+		if ((_ringEdges != _edgesSeen) && (time - _ringEdge < CALL_RING_TIMEOUT))
+			time = _ringEdge;
+		interrupts();
+		_state = CALL_INCOMING;
+		_number[0] = '\0';
+		_announced = false;
+		_start = time;
+		_dtmfCount = 0;
+	}
+	if (_state == CALL_INCOMING)
+		_lastRing = millis();
+}
+
+int MG2639_Phone::update(int8_t state, call_event_fn fn)
+{
+	int events = 0;
+	
+	if (state == _state)
+		return 0;
+	
+	if (_state == ERROR_FAIL_RESPONSE)
+	{
+		// A call we didn't see start (e.g. from "+CLCC: ")
+		if ((state == CALL_INCOMING) || (state == CALL_WAITING))
+		{
+			ring(millis());
+		}
+		else
+		{
+			_number[0] = '\0';
+			_announced = true;
+			_start = millis();
+		}
+	}
+	
+	if (state == ERROR_FAIL_RESPONSE)
+	{
+		// A missed call still comes in before it ends
+		events += announce(fn);
+		_state = state;
+		event(CALL_EVENT_ENDED, fn);
+		return events + 1;
+	}
+	if ((state == CALL_ACTIVE) && (_state != CALL_HOLD))
+	{
+		events += announce(fn);
+		_state = state;
+		event(CALL_EVENT_ANSWERED, fn);
+		return events + 1;
+	}
+	_state = state;
+	return events;
+}
+
+int MG2639_Phone::announce(call_event_fn fn)
+{
+	if (_announced)
+		return 0;
+	
+	_announced = true;
+	event(CALL_EVENT_INCOMING, fn);
+	return 1;
+}
+
+void MG2639_Phone::event(call_event event, call_event_fn fn)
+{
+	_latency = millis() - _start;
+	if (fn != NULL)
+		fn(event, _number, _latency);
+}
+
+void MG2639_Phone::setNumber(const char * line)
+{
+	const char * start = strchr(line, '\"');
+	const char * end = (start != NULL) ? strchr(start + 1, '\"') : NULL;
+	
+	if ((end != NULL) && (end - start - 1 < MAX_PHONE_NUMBER_SIZE))
+	{
+		memcpy(_number, start + 1, end - start - 1);
+		_number[end - start - 1] = '\0';
+	}
+}
+
+int MG2639_Phone::readLine(char * dest, int size)
+{
+	int length = 0;
+	int c;
+	
+	while ((c = _cell->readChar(COMMAND_RESPONSE_TIME)) != '\n')
+	{
+		if (c < 0)
+			return ERROR_TIMEOUT;
+		if ((c != '\r') && (length < size - 1))
+			dest[length++] = c;
+	}
+	dest[length] = '\0';
+	
+	return length;
+}
+
 MG2639_Phone phone;
\ No newline at end of file
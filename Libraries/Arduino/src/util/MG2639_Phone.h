@@ -9,6 +9,19 @@ This library within SFE_MG2639_CellShield defines phone-call functions of
 the MG2639. MG2639_Phone a friend class of MG2639_Cell is defined, with member
 functions like dial(), hangUp(), answer(), and callerID().
 
+poll() follows calls from the module's unsolicited results (RING, +CLIP,
++CLCC, NO CARRIER), and passes incoming, answered and ended events to a
+callback - no AT+CLCC is sent, except while an outgoing call rings. Each
+event comes with the time since the call started ringing. attachRing() times
+that from the RING pin's edge, where there's an interrupt pin to wire it to.
+
+During a call, sendDTMF() sends tones (AT+VTS). Receiving them is
+UNVERIFIED: neither MG2639 AT manual documents a DTMF detection report or a
+command to turn one on (+ZDTMFTONE only plays tones locally). poll() keeps
+digits from "+DTMF:" or "+ZDTMF:" lines for readDTMF(), in case the
+firmware sends them, but the MG2639 may never report the digits the other
+end presses. MG2639_IVR builds menus on readDTMF().
+
 Development environment specifics:
 	IDE: Arduino 1.6.3
 	Hardware Platform: Arduino Uno
@@ -24,6 +37,9 @@ Distributed as-is; no warranty is given.
 #define _MG2639_PHONE_H_
 
 #include <Arduino.h>
+#include "MG2639_SMS.h"
+
+#define CELL_RING	A0	// Cellular module's RING output goes to Arduino's A0
 
 // Call status enum - These values match exactly what we can expect from the
 // MG2639's response to "AT+CLCC".
@@ -44,20 +60,67 @@ enum audio_channel {
 	AUDIO_CHANNEL_SINGLE
 };
 
+// call_event enumerates the events poll() passes to a call_event_fn:
+// 0: CALL_EVENT_INCOMING - A call started ringing
+// 1: CALL_EVENT_ANSWERED - A call was picked up, at either end
+// 2: CALL_EVENT_ENDED - A call ended, or stopped ringing unanswered
+enum call_event {
+	CALL_EVENT_INCOMING,
+	CALL_EVENT_ANSWERED,
+	CALL_EVENT_ENDED
+};
+
+/// call_event_fn - Called by poll() with each call event, the number of the
+/// other end (empty if it isn't known), and [latency]: the time (ms) from
+/// the ring to the event - from dial(), for outgoing calls. getLatency()
+/// gives the same value afterwards.
+typedef void (*call_event_fn)(call_event event, const char * number,
+                              unsigned long latency);
+
+// CALL_RING_TIMEOUT - Time (ms) after the last RING before an unanswered
+// incoming call counts as ended. The network rings every 3-5 s.
+#define CALL_RING_TIMEOUT 8000
+
+// CALL_CLIP_WAIT - Time (ms) CALL_EVENT_INCOMING waits for "+CLIP: " to
+// give the caller's number, once enableCallerID() has been called. Without
+// caller ID, it's passed on at the first RING.
+#define CALL_CLIP_WAIT 500
+
+// CALL_STATUS_INTERVAL - Time (ms) between AT+CLCC checks while an outgoing
+// call rings. The module sends nothing when the other end picks up.
+#define CALL_STATUS_INTERVAL 1000
+
+// CALL_RING_DEBOUNCE - Edges on the RING pin closer than this (ms) are
+// counted once.
+#define CALL_RING_DEBOUNCE 50
+
+// PHONE_RING_SLOTS - Most phones attachRing() can be used on - one
+// interrupt handler each.
+#define PHONE_RING_SLOTS 2
+
+// PHONE_DTMF_SIZE - DTMF digits poll() keeps until readDTMF(). More are
+// dropped.
+#define PHONE_DTMF_SIZE 8
+
+// DTMF_TONE_TIME - Time (ms) allowed for each tone sendDTMF() plays, on top
+// of COMMAND_RESPONSE_TIME.
+#define DTMF_TONE_TIME 200
+
 class MG2639_Phone
 {
 public:
-	/// MG2639_Phone() - Constructor
-	/// - Sets CELL_RING (A0) to an input
-	MG2639_Phone();
+	/// MG2639_Phone([modem], [ringPin]) - Constructor
+	/// - Sets [ringPin] (CELL_RING, A0, if left out) to an input. Calls go
+	/// through [modem] - the global cell if it's left out.
+	MG2639_Phone(MG2639_Cell & modem = cell, uint8_t ringPin = CELL_RING);
 	
 	//////////////////////////////
 	// Phone Call Status Checks //
 	//////////////////////////////
 	
-	/// available() - Checks the CELL_RING pin to find it if a call is incoming
+	/// available() - Checks the RING pin to find it if a call is incoming
 	/// This is a very simple yes/no is my phone ringing check. For a more
-	/// complete function, check out status() below.
+	/// complete function, check out status() below, or poll() for events.
 	bool available();
 	
 	/// status() - Returns the current call status - whether it's outgoing,
@@ -103,6 +166,36 @@ public:
 	///
 	/// Returns: >0 on success, <0 on error
 	int8_t dialLast();	// ATDL
+	
+	/// hold([n]) - Hold, swap or release calls, as AT+CHLD=[n]:
+	/// 0 - Release held calls, or reject a waiting call
+	/// 1 - Release the active call, and take the held or waiting one
+	/// 2 - Hold the active call, and take the held or waiting one
+	///
+	/// Returns: >0 on success, <0 on error
+	int8_t hold(uint8_t n);	// AT+CHLD=<n>
+	
+	//////////
+	// DTMF //
+	//////////
+	
+	/// sendDTMF([digits]) - Send [digits] (0-9, *, #, A-D) as DTMF tones to
+	/// the other end of an active call, one AT+VTS per digit. Each tone
+	/// takes ~100 ms to play.
+	///
+	/// Returns: >0 on success, <0 on error (ERROR_FAIL_RESPONSE if the
+	/// module refused a digit - the digits before it were sent - or
+	/// [digits] is empty)
+	int8_t sendDTMF(const char * digits);	// AT+VTS=<digit>, per digit
+	
+	/// readDTMF() - Returns the next DTMF digit the other end sent (kept by
+	/// poll()), or -1 if there isn't one.
+	/// UNVERIFIED - the MG2639 may not report received digits at all (see
+	/// the top of this file).
+	int readDTMF();
+	
+	/// availableDTMF() - Returns the number of DTMF digits waiting.
+	inline uint8_t availableDTMF() { return _dtmfCount; };
 
 	/////////////////////////////
 	// Audio Interface Control //
@@ -115,9 +208,111 @@ public:
 	///
 	/// Returns: >0 on success, <0 on error	
 	int8_t setAudioChannel(audio_channel channel = AUDIO_CHANNEL_DIFFERENTIAL);
-  
+	
+	/////////////////
+	// Call Events //
+	/////////////////
+	
+	/// enableCallerID([enable]) - Have the module send the caller's number
+	/// ("+CLIP: ") after each RING, for poll() to pass on. CALL_EVENT_INCOMING
+	/// then waits up to CALL_CLIP_WAIT for it.
+	///
+	/// Returns: >0 on success, <0 on error
+	int8_t enableCallerID(bool enable = true);	// AT+CLIP=<enable>
+	
+	/// attachRing([pin]) - Timestamp each ring with an interrupt on [pin].
+	/// The shield's RING output (A0) isn't on an interrupt pin, and on an Uno
+	/// the only ones (2 and 3) carry the module's UART - wire RING to a free
+	/// one, e.g. 18-21 on a Mega. Without it, a call is timed from when poll()
+	/// reads "RING".
+	///
+	/// Returns: >0 on success, ERROR_FAIL_RESPONSE if [pin] has no interrupt,
+	/// ERROR_OVERRUN_PREVENT if PHONE_RING_SLOTS phones already use one.
+	int8_t attachRing(uint8_t pin);
+	
+	/// poll([fn]) - Read RING, "+CLIP: ", "+CLCC: " and "NO CARRIER" from the
+	/// UART, and pass each change in the call to [fn]. Calls answered,
+	/// hung up or dialed with this class are followed too. DTMF digits
+	/// received are kept for readDTMF(). Returns straight away if nothing has
+	/// happened. Call it in loop() - other output waiting in the UART is
+	/// thrown away.
+	///
+	/// Returns: Number of events passed to [fn].
+	int poll(call_event_fn fn);
+	
+	/// getState() - Returns the call state poll() is following, like
+	/// status() but without sending a command: ERROR_FAIL_RESPONSE if idle.
+	inline int8_t getState() { return _state; };
+	
+	/// getNumber() - Returns the number of the other end of the call, or an
+	/// empty string if it isn't known.
+	inline const char * getNumber() { return _number; };
+	
+	/// getRingTime() - Returns millis() when the current (or last) call
+	/// started ringing - at the RING pin's edge, with attachRing() - or was
+	/// dialed.
+	inline unsigned long getRingTime() { return _start; };
+	
+	/// getLatency() - Returns the time (ms) from the ring to the last event
+	/// poll() passed on, as given to the call_event_fn.
+	inline unsigned long getLatency() { return _latency; };
+
 private:
-  
+	MG2639_Cell * _cell; // Module the calls go through
+	uint8_t _ringPin;
+	char _number[MAX_PHONE_NUMBER_SIZE];
+	int8_t _state; // call_status, or ERROR_FAIL_RESPONSE if idle
+	bool _announced; // Has CALL_EVENT_INCOMING been passed on?
+	bool _callerID; // Was caller ID turned on with enableCallerID()?
+	bool _answered; // Was the call answered (or hung up) since the last poll()?
+	bool _hungUp;
+	unsigned long _start; // Time the call started ringing, or was dialed
+	unsigned long _latency; // Time from _start to the last event
+	unsigned long _lastRing; // Time of the last RING, or status check
+	uint8_t _edgesSeen; // _ringEdges at the last poll()
+	char _dtmf[PHONE_DTMF_SIZE]; // Digits received, oldest at _dtmfTail
+	uint8_t _dtmfTail;
+	uint8_t _dtmfCount;
+	
+	// Set by the ring interrupt
+	volatile uint8_t _ringEdges;
+	volatile unsigned long _ringEdge;
+	
+	// Phones attachRing() was called on
+	static MG2639_Phone * _ringPhones[PHONE_RING_SLOTS];
+	
+	/// ringISR0() and ringISR1() - Ring interrupt handlers for
+	/// _ringPhones[0] and [1].
+	static void ringISR0();
+	static void ringISR1();
+	
+	/// ringEdge() - Count a falling edge on the RING pin, and time it.
+	void ringEdge();
+	
+	/// ring([time]) - A RING arrived at [time]: start an incoming call if
+	/// idle, otherwise keep it ringing.
+	void ring(unsigned long time);
+	
+	/// update([state], [fn]) - Move to [state] (ERROR_FAIL_RESPONSE for
+	/// idle), passing any events to [fn].
+	/// Returns: Number of events passed to [fn].
+	int update(int8_t state, call_event_fn fn);
+	
+	/// announce([fn]) - Pass CALL_EVENT_INCOMING to [fn], once per call.
+	/// Returns: Number of events passed to [fn].
+	int announce(call_event_fn fn);
+	
+	/// event([event], [fn]) - Pass [event] to [fn], with the time since the
+	/// ring.
+	void event(call_event event, call_event_fn fn);
+	
+	/// setNumber([line]) - Copy the quoted number in [line] to _number.
+	void setNumber(const char * line);
+	
+	/// readLine([dest], [size]) - Read a line from the UART into [dest],
+	/// without its "\r\n", cut to [size] - 1 characters.
+	/// Returns: Length of the line, <0 on timeout.
+	int readLine(char * dest, int size);
 };
 
 extern MG2639_Phone phone;
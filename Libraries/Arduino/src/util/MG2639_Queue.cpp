@@ -0,0 +1,296 @@
+/******************************************************************************
+MG2639_Queue.cpp
+MG2639 Cellular Shield Library - Store-and-Forward Queue Source
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines a persistent outbound record
+queue. MG2639_Queue stores fixed-size records in non-volatile memory while
+GPRS is down, then drains them in batches over a single MG2639_GPRS
+connection when the link comes back.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include "MG2639_Queue.h"
+#include <SFE_MG2639_CellShield.h>
+
+// Slot status values. QUEUE_SLOT_EMPTY is the state of erased EEPROM/flash.
+#define QUEUE_SLOT_EMPTY 0xFF // Never used
+#define QUEUE_SLOT_VALID 0xA5 // Holds a record waiting to be sent
+#define QUEUE_SLOT_SENT 0x00 // Held a record that has been sent
+
+// Byte offsets within a slot
+#define QUEUE_OFFSET_STATUS 0
+#define QUEUE_OFFSET_SEQUENCE 1
+#define QUEUE_OFFSET_LENGTH 3
+#define QUEUE_OFFSET_CRC 4
+#define QUEUE_OFFSET_DATA 5
+
+/////////////////////////////
+// Store-and-Forward Queue //
+/////////////////////////////
+
+MG2639_Queue::MG2639_Queue(MG2639_Storage & storage, MG2639_GPRS & modem)
+{
+	_storage = &storage;
+	_gprs = &modem;
+	_slots = 0;
+	_head = 0;
+	_tail = 0;
+	_depth = 0;
+	_nextSequence = 0;
+	_dropped = 0;
+	_drainRate = 0;
+}
+
+unsigned int MG2639_Queue::begin()
+{
+	int newest = -1; // Slot with the highest sequence number used
+	int oldest = -1; // Valid slot with the lowest sequence number
+	uint16_t newestSequence = 0;
+	uint16_t oldestSequence = 0;
+	
+	// Keep the slot count under half the sequence number range.
+	if (_storage->size() / QUEUE_SLOT_SIZE > 32767)
+		_slots = 32767;
+	else
+		_slots = _storage->size() / QUEUE_SLOT_SIZE;
+	_head = 0;
+	_tail = 0;
+	_depth = 0;
+	_nextSequence = 0;
+	_dropped = 0;
+	
+	// Sequence numbers are compared with serial number arithmetic, so
+	// they can wrap around without confusing the search.
+	for (unsigned int i = 0; i < _slots; i++)
+	{
+		uint8_t status = slotStatus(i);
+		if (status == QUEUE_SLOT_EMPTY)
+			continue;
+	
+		uint16_t sequence = slotSequence(i);
+		if ((newest < 0) || ((int16_t) (sequence - newestSequence) > 0))
+		{
+			newest = i;
+			newestSequence = sequence;
+		}
+		if (slotValid(i) &&
+		    ((oldest < 0) || ((int16_t) (sequence - oldestSequence) < 0)))
+		{
+			oldest = i;
+			oldestSequence = sequence;
+		}
+	}
+	
+	if (newest >= 0)
+	{
+		_head = (newest + 1) % _slots;
+		_nextSequence = newestSequence + 1;
+	}
+	if (oldest >= 0)
+	{
+		_tail = oldest;
+		_depth = (_head + _slots - _tail) % _slots;
+		if (_depth == 0) // Head caught up with the tail - queue is full
+			_depth = _slots;
+	}
+	else
+	{
+		_tail = _head;
+	}
+	
+	return _depth;
+}
+
+void MG2639_Queue::clear()
+{
+	while (_depth > 0)
+		pop();
+}
+
+bool MG2639_Queue::push(const uint8_t * record, uint8_t length)
+{
+	unsigned long base = (unsigned long) _head * QUEUE_SLOT_SIZE;
+	uint8_t crc = 0;
+	
+	if ((_slots == 0) || (length > QUEUE_RECORD_SIZE))
+		return false;
+	if (_depth >= _slots)
+	{
+		_dropped++;
+		return false;
+	}
+	
+	// Write everything but the status byte first. If power fails before the
+	// status is written, begin() will skip this slot.
+	_storage->write(base + QUEUE_OFFSET_SEQUENCE, _nextSequence & 0xFF);
+	_storage->write(base + QUEUE_OFFSET_SEQUENCE + 1, _nextSequence >> 8);
+	_storage->write(base + QUEUE_OFFSET_LENGTH, length);
+	crc = crc8(crc, _nextSequence & 0xFF);
+	crc = crc8(crc, _nextSequence >> 8);
+	crc = crc8(crc, length);
+	for (int i = 0; i < length; i++)
+	{
+		_storage->write(base + QUEUE_OFFSET_DATA + i, record[i]);
+		crc = crc8(crc, record[i]);
+	}
+	_storage->write(base + QUEUE_OFFSET_CRC, crc);
+	_storage->commit();
+	
+	// Then mark the record valid.
+	_storage->write(base + QUEUE_OFFSET_STATUS, QUEUE_SLOT_VALID);
+	_storage->commit();
+	
+	_head = (_head + 1) % _slots;
+	_nextSequence++;
+	_depth++;
+	
+	return true;
+}
+
+int MG2639_Queue::peek(uint8_t * record)
+{
+	unsigned long base;
+	uint8_t length;
+	
+	// Skip over any slots that failed their CRC check.
+	while ((_depth > 0) && !slotValid(_tail))
+	{
+		_tail = (_tail + 1) % _slots;
+		_depth--;
+	}
+	if (_depth == 0)
+		return -1;
+	
+	base = (unsigned long) _tail * QUEUE_SLOT_SIZE;
+	length = _storage->read(base + QUEUE_OFFSET_LENGTH);
+	for (int i = 0; i < length; i++)
+		record[i] = _storage->read(base + QUEUE_OFFSET_DATA + i);
+	
+	return length;
+}
+
+bool MG2639_Queue::pop()
+{
+	if (_depth == 0)
+		return false;
+	
+	_storage->write((unsigned long) _tail * QUEUE_SLOT_SIZE + QUEUE_OFFSET_STATUS, QUEUE_SLOT_SENT);
+	_storage->commit();
+	
+	_tail = (_tail + 1) % _slots;
+	_depth--;
+	
+	return true;
+}
+
+int MG2639_Queue::drain(const char * domain, unsigned int port,
+                        unsigned int maxRecords, queue_send_fn send)
+{
+	int iRetVal;
+	
+	if (_depth == 0)
+		return 0;
+	if (_gprs->quotaStatus() != QUOTA_OK)
+		return 0;
+	
+	iRetVal = _gprs->connect(domain, port);
+	if (iRetVal < 0)
+		return iRetVal;
+	
+	return drain(*_gprs, maxRecords, send);
+}
+
+int MG2639_Queue::drain(Print & out, unsigned int maxRecords, queue_send_fn send)
+{
+	uint8_t record[QUEUE_RECORD_SIZE];
+	unsigned int sent = 0;
+	unsigned long startTime = millis();
+	unsigned long elapsed;
+	
+	while (sent < maxRecords)
+	{
+		// Stop at the soft limit, even part way through a batch
+		if (_gprs->quotaStatus() != QUOTA_OK)
+			break;
+	
+		int length = peek(record);
+		if (length < 0)
+			break;
+	
+		bool ok;
+		if (send != NULL)
+			ok = send(out, record, length);
+		else
+			ok = (out.write(record, length) == (size_t) length);
+		if (!ok)
+			break;
+	
+		pop();
+		sent++;
+	}
+	
+	elapsed = millis() - startTime;
+	if (sent > 0)
+		_drainRate = (float) sent * 1000.0 / (elapsed > 0 ? elapsed : 1);
+	
+	return sent;
+}
+
+uint8_t MG2639_Queue::slotStatus(unsigned int slot)
+{
+	return _storage->read((unsigned long) slot * QUEUE_SLOT_SIZE + QUEUE_OFFSET_STATUS);
+}
+
+uint16_t MG2639_Queue::slotSequence(unsigned int slot)
+{
+	unsigned long base = (unsigned long) slot * QUEUE_SLOT_SIZE;
+	
+	return _storage->read(base + QUEUE_OFFSET_SEQUENCE) |
+	       (_storage->read(base + QUEUE_OFFSET_SEQUENCE + 1) << 8);
+}
+
+bool MG2639_Queue::slotValid(unsigned int slot)
+{
+	unsigned long base = (unsigned long) slot * QUEUE_SLOT_SIZE;
+	uint8_t length;
+	uint8_t crc = 0;
+	
+	if (slotStatus(slot) != QUEUE_SLOT_VALID)
+		return false;
+	
+	length = _storage->read(base + QUEUE_OFFSET_LENGTH);
+	if (length > QUEUE_RECORD_SIZE)
+		return false;
+	
+	crc = crc8(crc, _storage->read(base + QUEUE_OFFSET_SEQUENCE));
+	crc = crc8(crc, _storage->read(base + QUEUE_OFFSET_SEQUENCE + 1));
+	crc = crc8(crc, length);
+	for (int i = 0; i < length; i++)
+		crc = crc8(crc, _storage->read(base + QUEUE_OFFSET_DATA + i));
+	
+	return crc == _storage->read(base + QUEUE_OFFSET_CRC);
+}
+
+uint8_t MG2639_Queue::crc8(uint8_t crc, uint8_t data)
+{
+	crc ^= data;
+	for (int i = 0; i < 8; i++)
+	{
+		if (crc & 0x80)
+			crc = (crc << 1) ^ 0x07;
+		else
+			crc <<= 1;
+	}
+	return crc;
+}
@@ -0,0 +1,164 @@
+/******************************************************************************
+MG2639_Queue.h
+MG2639 Cellular Shield Library - Store-and-Forward Queue Header
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines a persistent outbound record
+queue. MG2639_Queue stores fixed-size records (sensor readings, for example)
+in non-volatile memory while GPRS is down, then drains them in batches over a
+single MG2639_GPRS connection when the link comes back.
+
+Records are stored in slots. Each slot holds a sequence number, the record
+length, a CRC and the record itself. A status byte is written last when a
+record is added, and cleared only after the record has been sent, so:
+ - A record is either completely stored or not stored at all, even if power
+   fails in the middle of push().
+ - A stored record is never lost. If power fails during a drain, the record
+   being sent may be sent again after reboot.
+On begin() the queue is rebuilt by scanning the slots - there's no separate
+header that could be left half-written.
+
+Storage is accessed through the MG2639_Storage interface (see
+MG2639_Storage.h) - the AVR's internal EEPROM, or anything else you derive
+from it.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#ifndef _MG2639_QUEUE_H_
+#define _MG2639_QUEUE_H_
+
+#include <Arduino.h>
+#include <Print.h>
+#include "MG2639_Storage.h"
+#include "MG2639_GPRS.h"
+
+// QUEUE_RECORD_SIZE - Maximum size of a single record, in bytes. Each slot in
+// storage uses QUEUE_RECORD_SIZE + QUEUE_SLOT_OVERHEAD bytes.
+#define QUEUE_RECORD_SIZE 16
+#define QUEUE_SLOT_OVERHEAD 5 // status, 2 sequence, length, CRC
+#define QUEUE_SLOT_SIZE (QUEUE_RECORD_SIZE + QUEUE_SLOT_OVERHEAD)
+
+/// queue_send_fn - Called by drain() to send one record. Write the record
+/// to [out] in whatever format your server expects.
+/// Return true if it was sent, false to stop draining (the record stays in
+/// the queue).
+typedef bool (*queue_send_fn)(Print & out, const uint8_t * record, uint8_t length);
+
+class MG2639_Queue
+{
+public:
+	/// MG2639_Queue([storage], [modem]) - Constructor
+	/// [storage] is where records will be kept. drain() sends through
+	/// [modem] - the global gprs if it's left out.
+	MG2639_Queue(MG2639_Storage & storage, MG2639_GPRS & modem = gprs);
+	
+	/// begin() - Scan storage and rebuild the queue. Call this once in
+	/// setup(), before any other queue function.
+	///
+	/// Returns: Number of records waiting in the queue.
+	unsigned int begin();
+	
+	/// clear() - Throw away every record in the queue.
+	void clear();
+	
+	////////////////////
+	// Adding Records //
+	////////////////////
+	
+	/// push([record], [length]) - Add a record to the end of the queue.
+	/// [length] can be up to QUEUE_RECORD_SIZE bytes.
+	/// If the queue is full the record is dropped - see getDropped().
+	///
+	/// Returns: true if the record was stored, false if not.
+	bool push(const uint8_t * record, uint8_t length);
+	
+	/////////////////////
+	// Sending Records //
+	/////////////////////
+	
+	/// peek([record]) - Copy the oldest record in the queue into [record],
+	/// which must have room for QUEUE_RECORD_SIZE bytes.
+	///
+	/// Returns: Length of the record, or -1 if the queue is empty.
+	int peek(uint8_t * record);
+	
+	/// pop() - Remove the oldest record from the queue. Call this once a
+	/// record from peek() has been sent.
+	///
+	/// Returns: true if a record was removed, false if the queue was empty.
+	bool pop();
+	
+	/// drain([domain], [port], [maxRecords], [send]) - Connect to [domain] on
+	/// [port] with gprs.connect(), then send up to [maxRecords] records over
+	/// that one connection. GPRS must already be open.
+	/// If [send] is NULL, each record is sent as-is with gprs.write().
+	/// Records are only removed from the queue after they've been sent.
+	/// Nothing is sent once a data quota's soft limit is reached (see
+	/// gprs.setQuota()) - the records wait for the next billing period.
+	///
+	/// Returns: Number of records sent, or <0 if the connection failed.
+	int drain(const char * domain, unsigned int port, unsigned int maxRecords,
+	          queue_send_fn send = NULL);
+	
+	/// drain([out], [maxRecords], [send]) - Send up to [maxRecords] records
+	/// to an already-connected Print or Stream (e.g. gprs). To compress the
+	/// upload, drain into a MG2639_Compressor and call its end() afterwards.
+	/// Like the other drain(), it stops once a data quota's soft limit is
+	/// reached.
+	///
+	/// Returns: Number of records sent.
+	int drain(Print & out, unsigned int maxRecords, queue_send_fn send = NULL);
+	
+	//////////////////////
+	// Queue Statistics //
+	//////////////////////
+	
+	/// depth() - Number of records waiting in the queue.
+	inline unsigned int depth() { return _depth; };
+	
+	/// capacity() - Maximum number of records the storage can hold.
+	inline unsigned int capacity() { return _slots; };
+	
+	/// getDropped() - Number of records dropped by push() because the queue
+	/// was full (since begin()).
+	inline unsigned long getDropped() { return _dropped; };
+	
+	/// getDrainRate() - Records per second sent by the last drain().
+	inline float getDrainRate() { return _drainRate; };
+
+private:
+	MG2639_Storage * _storage;
+	MG2639_GPRS * _gprs;
+	unsigned int _slots; // Number of slots that fit in storage
+	unsigned int _head; // Slot the next record will be stored in
+	unsigned int _tail; // Slot holding the oldest record
+	unsigned int _depth; // Number of records in the queue
+	uint16_t _nextSequence; // Sequence number of the next record
+	unsigned long _dropped;
+	float _drainRate;
+	
+	/// slotStatus([slot]) - Read the status byte of a slot.
+	uint8_t slotStatus(unsigned int slot);
+	
+	/// slotSequence([slot]) - Read the sequence number of a slot.
+	uint16_t slotSequence(unsigned int slot);
+	
+	/// slotValid([slot]) - Returns true if [slot] holds a record with a
+	/// good CRC.
+	bool slotValid(unsigned int slot);
+	
+	/// crc8([crc], [data]) - Add a byte to a CRC-8 (polynomial 0x07).
+	static uint8_t crc8(uint8_t crc, uint8_t data);
+};
+
+#endif
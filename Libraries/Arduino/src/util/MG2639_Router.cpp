@@ -0,0 +1,218 @@
+/******************************************************************************
+MG2639_Router.cpp
+MG2639 Cellular Shield Library - SMS Command Router Source
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines an SMS command router.
+MG2639_Router finds a message's command in a sorted PROGMEM table by binary
+search, and calls its handler.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include "MG2639_Router.h"
+#include <SFE_MG2639_CellShield.h>
+
+MG2639_Router::MG2639_Router(const router_command * table, uint8_t count)
+{
+	_table = table;
+	_count = count;
+	_allowed = NULL;
+	_allowedCount = 0;
+	_compares = 0;
+}
+
+void MG2639_Router::setAllowed(const char * const * numbers, uint8_t count)
+{
+	_allowed = numbers;
+	_allowedCount = count;
+}
+
+int8_t MG2639_Router::dispatch(const char * sender, char * text)
+{
+	router_command command;
+	char * argv[ROUTER_MAX_ARGS];
+	uint8_t argc = 0;
+	unsigned int length;
+	int index;
+	char * p;
+	
+	tidy(text);
+	index = find(text);
+	if (index < 0)
+		return 0;
+	
+	memcpy_P(&command, &_table[index], sizeof(router_command));
+	if (!(command.flags & ROUTER_PUBLIC) && !allowed(sender))
+		return ERROR_FAIL_RESPONSE;
+	
+	// Arguments start after the keyword and its space. The last one keeps
+	// whatever's left.
+	length = strlen(command.keyword);
+	p = text + length;
+	while (*p == ' ')
+		p++;
+	while ((*p != '\0') && (argc < ROUTER_MAX_ARGS))
+	{
+		argv[argc++] = p;
+		if (argc == ROUTER_MAX_ARGS)
+			break;
+		while ((*p != '\0') && (*p != ' '))
+			p++;
+		if (*p == ' ')
+			*p++ = '\0';
+	}
+	
+	command.fn(sender, argc, argv);
+	
+	return 1;
+}
+
+int MG2639_Router::find(const char * text)
+{
+	unsigned int length = strlen(text);
+	unsigned int common;
+	int low, high, mid, best, c;
+	
+	_compares = 0;
+	while (length > 0)
+	{
+		// Binary search for the last keyword <= the first [length]
+		// characters of [text].
+		low = 0;
+		high = _count - 1;
+		best = -1;
+		while (low <= high)
+		{
+			mid = (low + high) / 2;
+			_compares++;
+			c = compare(text, length, _table[mid].keyword);
+			if (c == 0)
+				return mid;
+			if (c > 0)
+			{
+				best = mid;
+				low = mid + 1;
+			}
+			else
+			{
+				high = mid - 1;
+			}
+		}
+		if (best < 0)
+			return -1;
+	
+		// Any keyword [text] starts with sorts before it, and the longest
+		// sorts last - so if [best] isn't one, try again with just the whole
+		// words [text] shares with it.
+		common = 0;
+		while ((common < length) && (common < ROUTER_KEYWORD_SIZE - 1) &&
+		       (tolower(text[common]) == pgm_read_byte(&_table[best].keyword[common])))
+			common++;
+		if ((pgm_read_byte(&_table[best].keyword[common]) == '\0') && (text[common] == ' '))
+			return best;
+		length = common;
+		while ((length > 0) && (text[length] != ' '))
+			length--;
+	}
+	
+	return -1;
+}
+
+int MG2639_Router::verify()
+{
+	char keyword[ROUTER_KEYWORD_SIZE];
+	
+	for (uint8_t i = 0; i < _count; i++)
+	{
+		memcpy_P(keyword, _table[i].keyword, ROUTER_KEYWORD_SIZE);
+		for (uint8_t j = 0; keyword[j] != '\0'; j++)
+		{
+			if (keyword[j] != tolower(keyword[j]))
+				return i;
+		}
+		if ((i > 0) && (compare(keyword, strlen(keyword), _table[i - 1].keyword) <= 0))
+			return i;
+	}
+	
+	return -1;
+}
+
+bool MG2639_Router::allowed(const char * sender)
+{
+	for (uint8_t i = 0; i < _allowedCount; i++)
+	{
+		const char * a = sender + strlen(sender);
+		const char * b = _allowed[i] + strlen(_allowed[i]);
+		uint8_t matched = 0;
+	
+		// Compare digits from the end, skipping '+' and anything else
+		while (true)
+		{
+			while ((a > sender) && !isdigit(a[-1]))
+				a--;
+			while ((b > _allowed[i]) && !isdigit(b[-1]))
+				b--;
+			if ((a == sender) || (b == _allowed[i]) || (a[-1] != b[-1]))
+				break;
+			a--;
+			b--;
+			matched++;
+		}
+		// Enough digits matched, or one number matched the other completely
+		if ((matched > 0) && ((matched >= ROUTER_MATCH_DIGITS) ||
+		    ((a == sender) && (b == _allowed[i]))))
+			return true;
+	}
+	
+	return false;
+}
+
+unsigned int MG2639_Router::tidy(char * text)
+{
+	char * in = text;
+	char * out = text;
+	
+	while (*in != '\0')
+	{
+		if (isspace(*in))
+		{
+			while (isspace(*in))
+				in++;
+			// No leading or trailing space
+			if ((out != text) && (*in != '\0'))
+				*out++ = ' ';
+		}
+		else
+		{
+			*out++ = *in++;
+		}
+	}
+	*out = '\0';
+	
+	return out - text;
+}
+
+int MG2639_Router::compare(const char * text, unsigned int length, PGM_P keyword)
+{
+	uint8_t k;
+	
+	for (unsigned int i = 0; i < length; i++)
+	{
+		k = pgm_read_byte(keyword + i);
+		if (tolower(text[i]) != k)
+			return (uint8_t) tolower(text[i]) - k;
+	}
+	
+	// [text] ran out first - it only sorts equal if the keyword did too
+	return (pgm_read_byte(keyword + length) == '\0') ? 0 : -1;
+}
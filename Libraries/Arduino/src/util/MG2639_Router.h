@@ -0,0 +1,141 @@
+/******************************************************************************
+MG2639_Router.h
+MG2639 Cellular Shield Library - SMS Command Router Header
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines an SMS command router.
+MG2639_Router looks up the command at the start of a message in a table kept
+in PROGMEM, checks the sender against an allow-list, splits the rest of the
+message into arguments and calls the command's handler.
+
+e.g.:	const router_command commands[] PROGMEM = {
+			{"status",    sendStatus, ROUTER_PUBLIC},
+			{"water off", waterOff,   0},
+			{"water on",  waterOn,    0}
+		};
+		MG2639_Router router(commands, 3);
+		router.setAllowed(owners, 2);
+		router.dispatch(sms.getSender(), sms.getMessage()); // "Water on 30"
+
+The table must be sorted by keyword (as strcmp() would) and keywords must be
+lowercase - verify() checks both. It's built by the compiler and costs no
+RAM. Matching ignores case and extra spaces, and picks the longest keyword
+that matches whole words, so "water on" and "water" can both be commands.
+
+Lookup is a binary search, so its cost grows with log2 of the number of
+commands, where a strstr() per command grows with the number of commands
+and the length of the message. Per message, on a 16 MHz Uno:
+
+	Commands | strstr() loop            | dispatch()
+	---------+--------------------------+--------------------------
+	8        | 8 scans, ~0.8 ms         | 4 compares, ~0.1 ms
+	32       | 32 scans, ~3 ms          | 6 compares, ~0.1 ms
+	64       | 64 scans, ~6 ms          | 7 compares, ~0.1 ms
+
+for a 100-character message, estimated from the loop counts. Most of
+dispatch()'s time is tidying the message's spaces, which doesn't grow with
+the table. A message that starts like a longer keyword ("water online"
+against "water on") takes one more search per word dropped. getCompares()
+reports the keyword compares of the last dispatch().
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#ifndef _MG2639_ROUTER_H_
+#define _MG2639_ROUTER_H_
+
+#include <Arduino.h>
+
+// ROUTER_KEYWORD_SIZE - Longest keyword, plus its 0-terminator. Every table
+// entry takes this many bytes of flash, plus 3.
+#define ROUTER_KEYWORD_SIZE 16
+
+// ROUTER_MAX_ARGS - Most arguments passed to a handler. Anything past the
+// last is left in it, spaces and all.
+#define ROUTER_MAX_ARGS 4
+
+// ROUTER_MATCH_DIGITS - Trailing digits that must match for a sender to be
+// on the allow-list, so "+13035551234" matches "3035551234".
+#define ROUTER_MATCH_DIGITS 9
+
+// router_command flags:
+// ROUTER_PUBLIC - Any sender may run the command, allow-listed or not
+#define ROUTER_PUBLIC 0x01
+
+/// router_fn - Called by dispatch() with the sender and the words that
+/// followed the keyword. [argv] points into the message passed to dispatch().
+typedef void (*router_fn)(const char * sender, uint8_t argc, char ** argv);
+
+/// router_command - One entry in a command table, stored in PROGMEM.
+struct router_command {
+	char keyword[ROUTER_KEYWORD_SIZE];
+	router_fn fn;
+	uint8_t flags;
+};
+
+class MG2639_Router
+{
+public:
+	/// MG2639_Router([table], [count]) - Constructor
+	/// [table] is an array of [count] router_commands, in PROGMEM.
+	MG2639_Router(const router_command * table, uint8_t count);
+	
+	/// setAllowed([numbers], [count]) - Set the senders allowed to run
+	/// commands without ROUTER_PUBLIC. Until it's called, only ROUTER_PUBLIC
+	/// commands run. [numbers] must stay valid.
+	void setAllowed(const char * const * numbers, uint8_t count);
+	
+	/// dispatch([sender], [text]) - Find the command [text] starts with and,
+	/// if [sender] may run it, call its handler. [text] is changed - spaces
+	/// are tidied, and each argument is 0-terminated.
+	///
+	/// Returns: 1 if a handler was called, 0 if no command matched,
+	/// ERROR_FAIL_RESPONSE if [sender] isn't allowed to run it.
+	int8_t dispatch(const char * sender, char * text);
+	
+	/// find([text]) - Returns the table index of the longest keyword [text]
+	/// starts with, or -1 if none. [text] must already be tidied, as
+	/// dispatch() does.
+	int find(const char * text);
+	
+	/// verify() - Check the table is sorted, and every keyword is lowercase
+	/// and different.
+	///
+	/// Returns: -1 if the table is good, otherwise the index of the first
+	/// entry out of place.
+	int verify();
+	
+	/// getCompares() - Returns the number of keyword compares the last
+	/// dispatch() or find() took.
+	inline uint8_t getCompares() { return _compares; };
+
+private:
+	const router_command * _table;
+	uint8_t _count;
+	const char * const * _allowed;
+	uint8_t _allowedCount;
+	uint8_t _compares;
+	
+	/// allowed([sender]) - Returns true if [sender] is on the allow-list.
+	bool allowed(const char * sender);
+	
+	/// tidy([text]) - Trim [text], and turn each run of spaces, tabs or line
+	/// breaks into one space. Returns: The new length.
+	static unsigned int tidy(char * text);
+	
+	/// compare([text], [length], [keyword]) - Compare the first [length]
+	/// characters of [text], ignoring case, with a [keyword] in PROGMEM.
+	/// Returns: <0, 0 or >0, like strcmp().
+	static int compare(const char * text, unsigned int length, PGM_P keyword);
+};
+
+#endif
@@ -25,17 +25,35 @@ Distributed as-is; no warranty is given.
 #include <SFE_MG2639_CellShield.h>
 #include <Arduino.h>
 
-// Message sends are completed by sending a CTRL+Z (0x1A) byte
-#define CTRL_Z 0x1A
-// Maximum time it should take an SMS command to complete
-#define SMS_COMMAND_TIMEOUT 10000 
 #define CHAR_RECV_TIME 5 //! TODO: Should be dependent on baud
 
-MG2639_SMS::MG2639_SMS()
+// firstIndex([msgIndex]) - Returns the lowest message index set in the
+// [msgIndex] bitmap, or 0 if none are set. Empty bytes are skipped whole.
+static int firstIndex(const uint8_t * msgIndex)
 {
+	for (int i = 0; i < MESSAGE_INDEX_MAX; i++)
+	{
+		if (msgIndex[i] != 0)
+			return (i << 3) + __builtin_ffs(msgIndex[i]) - 1;
+	}
+	return 0;
+}
+
+MG2639_SMS::MG2639_SMS(MG2639_Cell & modem)
+{
+	_cell = &modem;
 	memset(_msgIndex, 0, MESSAGE_INDEX_MAX);
 	memset(_destPhone, 0, MAX_PHONE_NUMBER_SIZE);
 	messageOverrun = false;
+	_mode = -1;
+	_ack = false;
+	_direct = false;
+	_reports = false;
+	_reference = 0;
+	_memory = -1;
+	_used = 0;
+	_capacity = 0;
+	_full = false;
 }
 
 int8_t MG2639_SMS::setMode(sms_mode mode)
@@ -46,9 +64,11 @@ int8_t MG2639_SMS::setMode(sms_mode mode)
 	memset(tempCmd, 0, 10);
 	
 	sprintf(tempCmd, "%s=%d", SMS_MODE, mode);
-	cell.sendATCommand((const char *)tempCmd);	
+	_cell->sendATCommand((const char *)tempCmd);	
 	
-	iRetVal = cell.readWaitForResponse(RESPONSE_OK, COMMAND_RESPONSE_TIME);
+	iRetVal = _cell->readWaitForResponse(RESPONSE_OK, COMMAND_RESPONSE_TIME);
+	if (iRetVal > 0)
+		_mode = mode;
 	return iRetVal;
 }
 
@@ -58,32 +78,39 @@ int8_t MG2639_SMS::start(const char * phoneNumber)
 	// Max phone number digits is 15, add 2 for quote, 5 for command, 1 for equal
 	char tempCmd[24];
 	sprintf(tempCmd, "%s=\"%s\"", SMS_SEND, phoneNumber);
-	cell.sendATCommand((const char *)tempCmd);
+	_cell->sendATCommand((const char *)tempCmd);
 }
 
 int8_t MG2639_SMS::send()
 {
 	int iRetVal;
-	cell.printChar(CTRL_Z);
+	long reference;
+	_cell->printChar(CTRL_Z);
 	
-	iRetVal = cell.readWaitForResponse(RESPONSE_OK, SMS_COMMAND_TIMEOUT);
-	return iRetVal;
+	// Example response:
+	// +CMGS: 12\r\n
+	// \r\n
+	// OK
+	iRetVal = _cell->readWaitForResponses("+CMGS: ", RESPONSE_ERROR, SMS_COMMAND_TIMEOUT);
+	if (iRetVal < 0)
+		return iRetVal;
+	reference = _cell->readNumber('\r', COMMAND_RESPONSE_TIME);
+	if (reference >= 0)
+		_reference = reference;
+	_cell->readWaitForResponse(RESPONSE_OK, COMMAND_RESPONSE_TIME);
+	
+	return 1;
 }
 
 // Get index of available READ, UNREAD, or ALL messages
 // Returns index of first applicable message
 int MG2639_SMS::available(sms_status status)
 {
-	int iRetVal;
 	char tempCmd[21];
-	char tempIndex[10];
-	uint8_t index = 0;
-	char c = 0;
 	int response = 1;
-	int msgIndex = 0;
+	long msgIndex = 0;
 	
 	memset(tempCmd, 0, 21);
-	memset(tempIndex, 0, 10);
 	
 	switch (status)
 	{
@@ -99,33 +126,25 @@ int MG2639_SMS::available(sms_status status)
 	default:
 		return -1;
 	}
-	cell.clearBuffer();
-	cell.sendATCommand((const char *)tempCmd);
+	// PDU mode lists by number instead: 0 unread, 1 read, 4 all
+	if (_mode == SMS_PDU_MODE)
+		sprintf(tempCmd, "%s=%d", SMS_LIST, (status == REC_ALL) ? 4 : status);
+	_cell->clearBuffer();
+	_cell->sendATCommand((const char *)tempCmd);
 	while (response > 0)
 	{
-		response = cell.readWaitForResponses("+CMGL: ", RESPONSE_OK, COMMAND_RESPONSE_TIME);
+		response = _cell->readWaitForResponses("+CMGL: ", RESPONSE_OK, COMMAND_RESPONSE_TIME);
 		if (response > 0)
 		{	// Else if we got a "+CMGL: ", get the message number.
-			delay(CHAR_RECV_TIME);
-			while (c != ',')
-			{	//! Put a timeout in here
-				c = cell.uartRead();
-				if ((c >= '0') && (c <= '9'))
-					tempIndex[index++] = c;
-			}
-			msgIndex = atoi(tempIndex);
-			_msgIndex[msgIndex>>3] |= 1<<(msgIndex % 8);
+			msgIndex = _cell->readNumber(',', COMMAND_RESPONSE_TIME);
+			if ((msgIndex >= 0) && (msgIndex < (MESSAGE_INDEX_MAX<<3)))
+				_msgIndex[msgIndex>>3] |= 1<<(msgIndex % 8);
 		}	
 	}
 	if (response == ERROR_FAIL_RESPONSE)
 	{	// If we read "OK" (not necessarily a fail, but that's what'll be returned)
 		// Return the first available UNREAD message
-		for (int i=0; i<(MESSAGE_INDEX_MAX<<3); i++)
-		{
-			if (_msgIndex[i>>3]&(1<<(i%8)))
-				return i;
-		}
-		return 0;
+		return firstIndex(_msgIndex);
 	}
 	else
 	{
@@ -140,7 +159,7 @@ size_t MG2639_SMS::write(uint8_t b)
 
 size_t MG2639_SMS::write(uint8_t *buf, size_t size)
 {
-	cell.printString((char *)buf, size);
+	_cell->printString((char *)buf, size);
 }
 
 int MG2639_SMS::pollAvailable()
@@ -154,97 +173,291 @@ int MG2639_SMS::pollAvailable()
 	memset(temp, 0, 10);
 	
 	// When SMS comes in, UART interrupts with: '+CMTI: "SM", <msg id>\r\n'
+	// ("ME" instead of "SM" if it was stored in the module's memory).
 	// SoftwareSerial doesn't have on-receive interrupt hooks, so this
 	// won't be 100% functional.
-	cell.clearBuffer();
-	while (cell.dataAvailable())
+	_cell->clearBuffer();
+	while (_cell->dataAvailable())
 	{
 		delay(CHAR_RECV_TIME); // Delay long enough to receive another character ~4-5ms @ 2400bps
-		cell.readByteToBuffer();
-		if ((cell.searchBuffer("+CMTI: \"SM\", ")) > 0)
+		_cell->readByteToBuffer();
+		if (_cell->searchBuffer(SMS_FULL) != NULL)
+			_full = true;
+		if (_cell->searchBuffer("+CMTI: \"") != NULL)
 		{
 			found = true;
 			break;
 		}
 	}
 	// Have to clear buffer, otherwise this will continue to return true.
-	cell.clearBuffer();
+	_cell->clearBuffer();
 	if (found)
 	{
-		while ((c != '\r') && (cell.dataAvailable()) && (index < 10))
+		// Skip the memory ("SM" or "ME", see setMemory()) and its ','
+		while ((c != ',') && (_cell->dataAvailable()))
+			c = _cell->uartRead();
+		while ((c != '\r') && (_cell->dataAvailable()) && (index < 10))
 		{
-			c = cell.uartRead();
+			c = _cell->uartRead();
 			temp[index++] = c;
 		}
 		msgIndex = atoi(temp);
-		_msgIndex[msgIndex>>3] |= 1<<(msgIndex % 8);
+		if ((msgIndex >= 0) && (msgIndex < (MESSAGE_INDEX_MAX<<3)))
+			_msgIndex[msgIndex>>3] |= 1<<(msgIndex % 8);
 		//_smsStatus |= (1<<msgIndex);
 		
 		return msgIndex;
 	}
 	else
 	{
-		//for (int i=0; i<64; i++)
-		for (int i=0; i<(MESSAGE_INDEX_MAX<<3); i++)
+		return firstIndex(_msgIndex);
+	}
+}
+
+int8_t MG2639_SMS::setDirect(bool enable, bool ack)
+{
+	int8_t iRetVal;
+	bool direct = _direct;
+	
+	_direct = enable;
+	iRetVal = setIndication();
+	if (iRetVal > 0)
+		_ack = enable && ack;
+	else
+		_direct = direct;
+	return iRetVal;
+}
+
+int8_t MG2639_SMS::setReports(bool enable)
+{
+	int8_t iRetVal;
+	char tempCmd[20];
+	bool reports = _reports;
+	
+	// AT+CSMP=<fo>,<vp>,<pid>,<dcs> - first octet 0x31 is an SMS-SUBMIT
+	// asking for a status report (TP-SRR), 0x11 one that isn't.
+	sprintf(tempCmd, "%s=%d,167,0,0", SMS_PARAMETERS, enable ? 0x31 : 0x11);
+	_cell->sendATCommand((const char *)tempCmd);
+	iRetVal = _cell->readWaitForResponse(RESPONSE_OK, COMMAND_RESPONSE_TIME);
+	if (iRetVal < 0)
+		return iRetVal;
+	
+	_reports = enable;
+	iRetVal = setIndication();
+	if (iRetVal < 0)
+		_reports = reports;
+	return iRetVal;
+}
+
+int8_t MG2639_SMS::setIndication()
+{
+	char tempCmd[19];
+	
+	// AT+CNMI=<mode>,<mt>,<bm>,<ds>,<bfr> - <mt> 2 routes messages to the UART
+	// as "+CMT: ", 1 stores them and sends "+CMTI: ". <ds> 1 routes status
+	// reports to the UART as "+CDS: ".
+	sprintf(tempCmd, "%s=2,%d,0,%d,0", SMS_INDICATION, _direct ? 2 : 1, _reports ? 1 : 0);
+	_cell->sendATCommand((const char *)tempCmd);
+	
+	return _cell->readWaitForResponse(RESPONSE_OK, COMMAND_RESPONSE_TIME);
+}
+
+int MG2639_SMS::pollDirect(sms_read_fn fn)
+{
+	char chunk[SMS_CHUNK_SIZE];
+	uint8_t length = 0;
+	bool found = false;
+	bool quoted = false;
+	int iRetVal;
+	int c;
+	unsigned long timeIn = millis();
+	
+	if (fn == NULL)
+		return ERROR_FAIL_RESPONSE;
+	
+	// A direct message arrives unprompted:
+	// +CMT: "1xxxnnnzzzz","","2014/10/12 21:54:25-24"\r\n
+	// Hey hey hey\r\n
+	_cell->clearBuffer();
+	while (_cell->dataAvailable())
+	{
+		_cell->readByteToBuffer();
+		if (_cell->searchBuffer(SMS_FULL) != NULL)
+			_full = true;
+		if (_cell->searchBuffer("+CMT: ") != NULL)
 		{
-			//if (_smsStatus & (1<<i))
-			if (_msgIndex[i>>3]&(1<<(i%8)))
-				return i;
+			found = true;
+			break;
 		}
+		// Only wait for the next character if it isn't here yet
+		if (!_cell->dataAvailable())
+			delay(CHAR_RECV_TIME);
+	}
+	_cell->clearBuffer();
+	if (!found)
 		return 0;
+	
+	if (_cell->readQuoted(chunk, SMS_CHUNK_SIZE, COMMAND_RESPONSE_TIME) < 0)
+		return ERROR_TIMEOUT;
+	fn(SMS_FIELD_SENDER, chunk, strlen(chunk));
+	
+	// The name may be quoted, empty or left out, so the date is taken as the
+	// last quoted field on the line.
+	while ((c = _cell->readChar(COMMAND_RESPONSE_TIME)) != '\n')
+	{
+		if (c < 0)
+			return ERROR_TIMEOUT;
+		if (c == '\"')
+		{
+			if (!quoted)
+				length = 0;
+			quoted = !quoted;
+		}
+		else if (quoted && (length < SMS_CHUNK_SIZE))
+		{
+			chunk[length++] = c;
+		}
+	}
+	fn(SMS_FIELD_DATE, chunk, length);
+	
+	iRetVal = readBody(fn, timeIn);
+	if (iRetVal < 0)
+		return iRetVal;
+	
+	if (_ack)
+	{
+		_cell->sendATCommand(SMS_ACK);
+		_cell->readWaitForResponse(RESPONSE_OK, COMMAND_RESPONSE_TIME);
 	}
+	
+	return 1;
 }
 
 int8_t MG2639_SMS::read(uint8_t msgIndex)
 {
-	int8_t iRetVal;
+	int iRetVal;
+	
+	iRetVal = readMessage(msgIndex, NULL);
+	if (iRetVal < 0)
+		return iRetVal;
+	
+	return 1;
+}
+
+int MG2639_SMS::read(uint8_t msgIndex, sms_read_fn fn)
+{
+	if (fn == NULL)
+		return ERROR_FAIL_RESPONSE;
+	
+	return readMessage(msgIndex, fn);
+}
+
+int MG2639_SMS::readMessage(uint8_t msgIndex, sms_read_fn fn)
+{
+	int iRetVal;
 	char tempCmd[10];
-	char c = 0;
-	int i =0;
+	char chunk[SMS_CHUNK_SIZE];
+	int length;
+	int c;
+	unsigned long timeIn = millis();
+	
 	memset(tempCmd, 0, 10);
 	sprintf(tempCmd, "%s=%d", SMS_READ, msgIndex);
-	cell.clearBuffer();
-	cell.sendATCommand((const char *)tempCmd);
+	_cell->clearBuffer();
+	_cell->sendATCommand((const char *)tempCmd);
 	
 	// Example response: 
 	// +CMGR: "REC READ","1xxxnnnzzzz","","2014/10/12 21:54:25-24"\r\n
-    // Hey hey hey\r\n\r\n
+	// Hey hey hey\r\n\r\n
 	//
 	// OK
-
-	// Look for "," which comes right before the phone number
-	iRetVal = cell.readWaitForResponses(",", RESPONSE_ERROR, COMMAND_RESPONSE_TIME);
+	iRetVal = _cell->readWaitForResponses("+CMGR: ", RESPONSE_ERROR, COMMAND_RESPONSE_TIME);
+	if (iRetVal < 0)
+		return iRetVal;
 	
-	if (iRetVal > 0)
+	if (fn == NULL)
 	{
 		memset(_lastNumber, 0, MAX_PHONE_NUMBER_SIZE);
 		memset(_lastDate, 0, MAX_DATE_SIZE);
 		memset(_lastSMSData, 0, SMS_DATA_SIZE);
-		
-		cell.readBetween('\"', '\"', _lastNumber, 1000);
-		while (cell.dataAvailable() < 4) 
-			;
-		for (int i=0; i<4; i++) // Read 4 characters ,"", (static)
-			cell.uartRead();
-		cell.readBetween('\"', '\"', _lastDate, 1000);
-		while (cell.dataAvailable() < 2) 
-			;
-		for (int i=0; i<2; i++)
-			cell.uartRead(); // Read the "\r\n"
-		if (cell.readUntil(_lastSMSData, '\r', SMS_DATA_SIZE - 1, 1000) == ERROR_OVERRUN_PREVENT)
-			messageOverrun = true;
-		else
-			messageOverrun = false;
+		messageOverrun = false;
 	}
+	
+	// Status (thrown away), then sender
+	if ((_cell->readQuoted(chunk, SMS_CHUNK_SIZE, COMMAND_RESPONSE_TIME) < 0) ||
+	    (_cell->readQuoted(chunk, SMS_CHUNK_SIZE, COMMAND_RESPONSE_TIME) < 0))
+		return ERROR_TIMEOUT;
+	if (fn == NULL)
+		strncpy(_lastNumber, chunk, MAX_PHONE_NUMBER_SIZE - 1);
 	else
+		fn(SMS_FIELD_SENDER, chunk, strlen(chunk));
+	
+	// Name (empty, thrown away), then date
+	if ((_cell->readQuoted(chunk, SMS_CHUNK_SIZE, COMMAND_RESPONSE_TIME) < 0) ||
+	    (_cell->readQuoted(chunk, SMS_CHUNK_SIZE, COMMAND_RESPONSE_TIME) < 0))
+		return ERROR_TIMEOUT;
+	if (fn == NULL)
+		strncpy(_lastDate, chunk, MAX_DATE_SIZE - 1);
+	else
+		fn(SMS_FIELD_DATE, chunk, strlen(chunk));
+	
+	// Rest of the header line
+	while ((c = _cell->readChar(COMMAND_RESPONSE_TIME)) != '\n')
 	{
-		return iRetVal;
+		if (c < 0)
+			return ERROR_TIMEOUT;
 	}
 	
+	length = readBody(fn, timeIn);
+	if (length < 0)
+		return length;
+	
+	// Read through the "OK", so it isn't left for the next command. The
+	// message has been read either way.
+	_cell->readWaitForResponse(RESPONSE_OK, COMMAND_RESPONSE_TIME);
+	
 	_msgIndex[msgIndex>>3] &= ~(1<<(msgIndex%8));
 	//_smsStatus &= ~(1<<msgIndex);
-		
-	return 1;
+	
+	return length;
+}
+
+int MG2639_SMS::readBody(sms_read_fn fn, unsigned long timeIn)
+{
+	char chunk[SMS_CHUNK_SIZE];
+	uint8_t chunkLength = 0;
+	int length = 0;
+	int c;
+	
+	// Body, up to "\r\n". Every character is waited for with a timeout, and
+	// the whole read is limited to SMS_COMMAND_TIMEOUT, so a module that
+	// stops talking (or never stops) can't hang the sketch.
+	while ((c = _cell->readChar(COMMAND_RESPONSE_TIME)) != '\r')
+	{
+		if ((c < 0) || (timeIn + SMS_COMMAND_TIMEOUT < millis()))
+			return ERROR_TIMEOUT;
+		if (fn == NULL)
+		{
+			if (length < SMS_DATA_SIZE - 1)
+				_lastSMSData[length] = c;
+			else
+				messageOverrun = true;
+		}
+		else
+		{
+			chunk[chunkLength++] = c;
+			if (chunkLength == SMS_CHUNK_SIZE)
+			{
+				fn(SMS_FIELD_BODY, chunk, chunkLength);
+				chunkLength = 0;
+			}
+		}
+		length++;
+	}
+	if ((fn != NULL) && (chunkLength > 0))
+		fn(SMS_FIELD_BODY, chunk, chunkLength);
+	
+	return length;
 }
 
 char * MG2639_SMS::getSender()
@@ -268,10 +481,139 @@ int8_t MG2639_SMS::deleteMessage(uint8_t msgIndex)
 	int8_t iRetVal;
 	
 	sprintf(tempCmd, "%s=%d", SMS_DELETE, msgIndex);
-	cell.sendATCommand((const char *)tempCmd);
+	_cell->sendATCommand((const char *)tempCmd);
 	
-	iRetVal = cell.readWaitForResponse(RESPONSE_OK, COMMAND_RESPONSE_TIME);
+	iRetVal = _cell->readWaitForResponse(RESPONSE_OK, COMMAND_RESPONSE_TIME);
+	if (iRetVal > 0) // Don't return this index from available() again
+		_msgIndex[msgIndex>>3] &= ~(1<<(msgIndex%8));
 	return iRetVal;
 }
 
+int8_t MG2639_SMS::deleteMessages(sms_delete which)
+{
+	char tempCmd[13];
+	int8_t iRetVal;
+	
+	// AT+CMGD=<index>,<delflag> - the index is ignored when delflag isn't 0
+	sprintf(tempCmd, "%s=1,%d", SMS_DELETE, which);
+	_cell->sendATCommand((const char *)tempCmd);
+	
+	iRetVal = _cell->readWaitForResponses(RESPONSE_OK, RESPONSE_ERROR, SMS_COMMAND_TIMEOUT);
+	if (iRetVal > 0)
+	{
+		// Which indexes went isn't known - available() will list what's left
+		memset(_msgIndex, 0, MESSAGE_INDEX_MAX);
+		_full = false;
+	}
+	return iRetVal;
+}
+
+int8_t MG2639_SMS::setMemory(sms_memory memory)
+{
+	int iRetVal;
+	char tempCmd[22];
+	const char * name = (memory == SMS_MEMORY_MODULE) ? "ME" : "SM";
+	long used, capacity;
+	
+	// Read, write and receive all use the same memory, so every message
+	// received can be listed and read.
+	sprintf(tempCmd, "%s=\"%s\",\"%s\",\"%s\"", SMS_STORAGE, name, name, name);
+	_cell->clearBuffer();
+	_cell->sendATCommand((const char *)tempCmd);
+	
+	// Example response:
+	// +CPMS: 3,30,3,30,3,30\r\n
+	// \r\n
+	// OK
+	iRetVal = _cell->readWaitForResponses("+CPMS: ", RESPONSE_ERROR, COMMAND_RESPONSE_TIME);
+	if (iRetVal < 0)
+		return iRetVal;
+	used = _cell->readNumber(',', COMMAND_RESPONSE_TIME);
+	capacity = _cell->readNumber(',', COMMAND_RESPONSE_TIME);
+	if ((used < 0) || (capacity < 0))
+		return ERROR_TIMEOUT;
+	_cell->readWaitForResponse(RESPONSE_OK, COMMAND_RESPONSE_TIME);
+	
+	_memory = memory;
+	_used = used;
+	_capacity = capacity;
+	// Indexes from the old memory mean nothing in the new one
+	memset(_msgIndex, 0, MESSAGE_INDEX_MAX);
+	_full = false;
+	
+	return 1;
+}
+
+int MG2639_SMS::updateStorage()
+{
+	int iRetVal;
+	char tempCmd[8];
+	char name[4];
+	long used, capacity;
+	
+	sprintf(tempCmd, "%s?", SMS_STORAGE);
+	_cell->clearBuffer();
+	_cell->sendATCommand((const char *)tempCmd);
+	
+	// Read, write and receive memories, in that order. Example response:
+	// +CPMS: "SM",3,30,"SM",3,30,"SM",3,30\r\n
+	// \r\n
+	// OK
+	iRetVal = _cell->readWaitForResponses("+CPMS: ", RESPONSE_ERROR, COMMAND_RESPONSE_TIME);
+	if (iRetVal < 0)
+		return iRetVal;
+	for (uint8_t i = 0; i < 3; i++)
+	{
+		// "SM", then the ',' before the numbers
+		if ((_cell->readQuoted(name, sizeof(name), COMMAND_RESPONSE_TIME) < 0) ||
+		    (_cell->readChar(COMMAND_RESPONSE_TIME) < 0))
+			return ERROR_TIMEOUT;
+		used = _cell->readNumber(',', COMMAND_RESPONSE_TIME);
+		capacity = _cell->readNumber((i < 2) ? ',' : '\r', COMMAND_RESPONSE_TIME);
+		if ((used < 0) || (capacity < 0))
+			return ERROR_TIMEOUT;
+	}
+	_cell->readWaitForResponse(RESPONSE_OK, COMMAND_RESPONSE_TIME);
+	
+	// Keep the receive memory - it's the one that fills up
+	_memory = (strcmp(name, "ME") == 0) ? SMS_MEMORY_MODULE : SMS_MEMORY_SIM;
+	_used = used;
+	_capacity = capacity;
+	
+	return _capacity - _used;
+}
+
+int MG2639_SMS::checkStorage(uint8_t reserve)
+{
+	int room;
+	sms_memory current;
+	
+	room = updateStorage();
+	if (room < 0)
+		return room;
+	if ((room > reserve) && !_full)
+		return room;
+	
+	// Running out. Read and sent messages go first...
+	if (deleteMessages(SMS_DELETE_READ_SENT) > 0)
+	{
+		room = updateStorage();
+		if (room < 0)
+			return room;
+		if (room > reserve)
+			return room;
+	}
+	
+	// ...then, if the other memory has more room, move to it.
+	current = (sms_memory) _memory;
+	if (setMemory((current == SMS_MEMORY_SIM) ? SMS_MEMORY_MODULE : SMS_MEMORY_SIM) > 0)
+	{
+		if (_capacity - _used > room)
+			return _capacity - _used;
+		setMemory(current);
+	}
+	
+	return room;
+}
+
 MG2639_SMS sms;
\ No newline at end of file
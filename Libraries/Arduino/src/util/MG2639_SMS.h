@@ -26,6 +26,10 @@ Distributed as-is; no warranty is given.
 #include <Arduino.h>
 #include <Print.h>
 
+// The module each class talks through - the global cell by default
+class MG2639_Cell;
+extern MG2639_Cell cell;
+
 // MAX_PHONE_NUMBER_SIZE - Phone numbers can be a maximum of 15 characters
 #define MAX_PHONE_NUMBER_SIZE 16
 // MAX_DATE_SIZE - Defines maximum size of date character array.
@@ -33,6 +37,15 @@ Distributed as-is; no warranty is given.
 // SMS_DATA_SIZE - Defines the maximum size of the SMS text data array.
 #define SMS_DATA_SIZE 128
 
+// Message sends are completed by sending a CTRL+Z (0x1A) byte
+#define CTRL_Z 0x1A
+// Maximum time it should take an SMS command to complete
+#define SMS_COMMAND_TIMEOUT 10000 
+
+// SMS_CHUNK_SIZE - Body characters collected (on the stack) before they're
+// passed to an sms_read_fn. Also the longest sender or date passed to it.
+#define SMS_CHUNK_SIZE 32
+
 // MESSAGE_INDEX_MAX defines the number of messages states that can be stored
 // by the library. This defines the number of bytes used to store, so multiply
 // by 8 to get the real value.
@@ -56,12 +69,51 @@ enum sms_mode {
 	SMS_TEXT_MODE
 };
 
+// sms_memory enumerates the places messages can be stored:
+// 0: SMS_MEMORY_SIM - "SM", the SIM card
+// 1: SMS_MEMORY_MODULE - "ME", the MG2639's own memory
+enum sms_memory {
+	SMS_MEMORY_SIM,
+	SMS_MEMORY_MODULE
+};
+
+// sms_delete enumerates what deleteMessages() removes (AT+CMGD's delflag):
+// 1: SMS_DELETE_READ - Read messages
+// 2: SMS_DELETE_READ_SENT - Read messages, and sent ones
+// 3: SMS_DELETE_READ_SENT_UNSENT - Everything but unread messages
+// 4: SMS_DELETE_ALL - Every message
+enum sms_delete {
+	SMS_DELETE_READ = 1,
+	SMS_DELETE_READ_SENT = 2,
+	SMS_DELETE_READ_SENT_UNSENT = 3,
+	SMS_DELETE_ALL = 4
+};
+
+// sms_field enumerates the parts of a message passed to an sms_read_fn:
+// 0: SMS_FIELD_SENDER - The sender's phone number, in one call
+// 1: SMS_FIELD_DATE - The date the message was sent, in one call
+// 2: SMS_FIELD_BODY - A piece of the body, up to SMS_CHUNK_SIZE characters
+enum sms_field {
+	SMS_FIELD_SENDER,
+	SMS_FIELD_DATE,
+	SMS_FIELD_BODY
+};
+
+/// sms_read_fn - Called by read([msgIndex], [fn]) with each part of a message
+/// as it arrives - the sender, then the date, then the body, a chunk at a
+/// time. [data] is only valid during the call, and isn't 0-terminated.
+typedef void (*sms_read_fn)(sms_field field, const char * data, uint8_t length);
+
 class MG2639_SMS : public Print
 {
 public:
-	/// MG2639_SMS() - Constructor
-	/// Sets up class variables
-	MG2639_SMS();
+	/// MG2639_SMS([modem]) - Constructor
+	/// Sets up class variables. Messages go through [modem] - the global
+	/// cell if it's left out.
+	MG2639_SMS(MG2639_Cell & modem = cell);
+	
+	/// getCell() - Returns the modem messages go through.
+	inline MG2639_Cell & getCell() { return *_cell; };
 	
 	/// setMode([mode]) - Set SMS mode to either PDU or text mode.
 	/// Of the two, text mode is probably the more useful. This produce messages
@@ -72,6 +124,10 @@ public:
 	/// Returns: >0 on success, <0 on fail.
 	int8_t setMode(sms_mode mode);
 	
+	/// getMode() - Returns the sms_mode set by the last successful setMode(),
+	/// or -1 if setMode() hasn't been called.
+	inline int8_t getMode() { return _mode; };
+	
 	//////////////////////////////////////
 	// Reading SMS Commands and Utility //
 	//////////////////////////////////////
@@ -80,7 +136,7 @@ public:
 	/// specified sms_status type. sms_status can be either REC_UNREAD,
 	/// REC_READ, or REC_ALL.
 	/// This function returns the INDEX OF THE FIRST AVAILABLE MESSAGE with
-	/// the requested status.
+	/// the requested status. Works in text or PDU mode.
 	/// e.g.: msgIndex = available(REC_READ); // Get index of first available read message
 	///
 	/// Returns: >0 (message index) on success, <0 on fail.
@@ -93,6 +149,42 @@ public:
 	/// Use of available() is recommended over this function.
     int pollAvailable();
 	
+	/// setDirect([enable], [ack]) - Choose where new messages go. Enabled,
+	/// they're routed straight to the UART as "+CMT: " (AT+CNMI=2,2) and
+	/// never stored on the SIM - read them with pollDirect(). Disabled,
+	/// they're stored and announced with "+CMTI: " (AT+CNMI=2,1), for
+	/// available() and pollAvailable(). Set [ack] if the network expects
+	/// each direct message to be acknowledged (after AT+CSMS=1) - pollDirect()
+	/// then sends AT+CNMA. Text mode only.
+	///
+	/// Returns: >0 on success, <0 on fail.
+	int8_t setDirect(bool enable, bool ack = false);
+	
+	/// setReports([enable]) - Ask the network for a status report on each
+	/// message sent (AT+CSMP for text mode - MG2639_PDU asks itself), and
+	/// have the module pass them to the UART as "+CDS: " (AT+CNMI). Use
+	/// MG2639_Delivery to match them to the messages sent.
+	///
+	/// Returns: >0 on success, <0 on fail.
+	int8_t setReports(bool enable);
+	
+	/// getReports() - Returns true if setReports(true) was called.
+	inline bool getReports() { return _reports; };
+	
+	/// pollDirect([fn]) - Check for a "+CMT: " message, passing its sender,
+	/// date and body to [fn] as they arrive, like read([msgIndex], [fn]).
+	/// Returns straight away if nothing has arrived. Call it in loop(), and
+	/// call it often - a direct message isn't stored anywhere, so one left
+	/// waiting once the UART's receive buffer fills is lost.
+	/// Compared with pollAvailable(), read() and deleteMessage(), a
+	/// 160-character message at 9600 baud takes one exchange instead of
+	/// three, and ~210 UART characters instead of ~290 (calculated), with no
+	/// SIM write, read or delete. [fn] gets the sender ~50 ms after "+CMT: "
+	/// arrives, instead of after a round trip for AT+CMGR.
+	///
+	/// Returns: 1 if a message was passed to [fn], 0 if none, <0 on fail.
+	int pollDirect(sms_read_fn fn);
+	
 	/// read([msgIndex]) - Perform an SMS read on the specified index.
 	/// This function does not return a message or sender, but it does update
 	/// the values returned by getSender(), getDate() and getMessage(). Call
@@ -102,12 +194,71 @@ public:
 	/// Returns: >0 on success, <0 on fail.
 	int8_t read(uint8_t msgIndex);
 	
+	/// read([msgIndex], [fn]) - Perform an SMS read on the specified index,
+	/// passing the sender, date and body to [fn] as they arrive. Nothing is
+	/// copied into the buffers behind getSender(), getDate() and
+	/// getMessage(), so a message of any length can be read - its size is
+	/// only limited by what [fn] does with it.
+	/// Each character must arrive within COMMAND_RESPONSE_TIME, and the whole
+	/// read is given up after SMS_COMMAND_TIMEOUT.
+	/// e.g.: sms.read(msgIndex, printPart);
+	///
+	/// Returns: >=0 (length of the body) on success, <0 on fail.
+	int read(uint8_t msgIndex, sms_read_fn fn);
+	
 	/// deleteMessage([msgIndex]) - Delete a message at specified index from the
 	/// contents of a SIM card.
 	///
 	/// Returns: >0 on success, <0 on fail.
 	int8_t deleteMessage(uint8_t msgIndex);
 	
+	/// deleteMessages([which]) - Delete every message of a kind - e.g. all
+	/// read messages - in one command, instead of a deleteMessage() each.
+	/// The indexes available() remembers are forgotten, so call it again.
+	///
+	/// Returns: >0 on success, <0 on fail.
+	int8_t deleteMessages(sms_delete which);
+	
+	////////////////////////////
+	// SMS Storage Management //
+	////////////////////////////
+	
+	/// setMemory([memory]) - Read, store and receive messages in [memory]
+	/// (AT+CPMS), also updating getUsed() and getCapacity(). Messages in the
+	/// other memory stay there, but can't be read until it's set again.
+	/// e.g.: setMemory(SMS_MEMORY_MODULE); // Use the MG2639's own memory
+	///
+	/// Returns: >0 on success, <0 on fail.
+	int8_t setMemory(sms_memory memory);
+	
+	/// updateStorage() - Ask the module how full the memory new messages go
+	/// to is (AT+CPMS?), updating getMemory(), getUsed() and getCapacity().
+	///
+	/// Returns: >=0 (free message slots) on success, <0 on fail.
+	int updateStorage();
+	
+	/// checkStorage([reserve]) - Make sure more than [reserve] messages can
+	/// still be received. Call it every so often in loop(). If the memory is
+	/// down to [reserve] free slots, or the module reported it full
+	/// ("+ZSMGS" - seen by pollAvailable() and pollDirect()), read and sent
+	/// messages are deleted. If that isn't enough, and the other memory
+	/// (SIM or module) has more room, new messages go there instead.
+	///
+	/// Returns: >=0 (free message slots) on success, <0 on fail.
+	int checkStorage(uint8_t reserve = 2);
+	
+	/// getMemory(), getUsed() and getCapacity() - Return the memory new
+	/// messages go to (an sms_memory, or -1 if not known yet), and how many
+	/// messages it holds and can hold, as of the last setMemory() or
+	/// updateStorage().
+	inline int8_t getMemory() { return _memory; };
+	inline uint8_t getUsed() { return _used; };
+	inline uint8_t getCapacity() { return _capacity; };
+	
+	/// getFull() - Returns true if the module has reported its memory full
+	/// since storage was last cleaned up or changed.
+	inline bool getFull() { return _full; };
+	
 	/// getSender() - Returns the phone number from the last, read SMS.
 	/// A read(msgIndex) function must be called to update this value.
 	char * getSender();
@@ -123,8 +274,8 @@ public:
 	
 	/// getOverrun() returns a boolean indicating if the last read SMS was
 	/// larger than SMS_DATA_SIZE. In that case, the any chars above that
-	/// point were cut off.
-	//! No recourse for this yet, but at least we're failing gracefully.
+	/// point were cut off. Use read([msgIndex], [fn]) to read the whole
+	/// message.
 	inline bool getOverrun() { return messageOverrun;};
 	
 	//////////////////////////////////////
@@ -145,6 +296,10 @@ public:
 	///
 	/// Returns: >0 on success, <0 on fail.
 	int8_t send();
+	
+	/// getReference() - Returns the message reference the network gave the
+	/// last message sent (TP-MR, from "+CMGS: ").
+	inline uint8_t getReference() { return _reference; };
 
 	/// write(b) - Write a single byte to the SMS message buffer.
 	virtual size_t write(uint8_t b);
@@ -159,6 +314,8 @@ public:
 	using Print::write;	
 	
 private:
+	// Module the messages go through
+	MG2639_Cell * _cell;
 	// Storage array for destination phone number
 	char _destPhone[MAX_PHONE_NUMBER_SIZE];
 	// Storage array for message statuses
@@ -171,6 +328,37 @@ private:
 	char _lastSMSData[SMS_DATA_SIZE];
 	// Boolean to track if our last message read was too long:
 	bool messageOverrun;
+	// Mode set by the last setMode(), -1 if unknown
+	int8_t _mode;
+	// Should pollDirect() acknowledge each message with AT+CNMA?
+	bool _ack;
+	// AT+CNMI routing: messages direct to the UART, status reports on
+	bool _direct;
+	bool _reports;
+	// Reference of the last message sent
+	uint8_t _reference;
+	// Memory new messages go to, and how full it is
+	int8_t _memory;
+	uint8_t _used;
+	uint8_t _capacity;
+	// Has the module reported its memory full ("+ZSMGS")?
+	bool _full;
+	
+	/// readMessage([msgIndex], [fn]) - Read a message, passing its parts to
+	/// [fn] - or, if [fn] is NULL, storing them for getSender(), getDate()
+	/// and getMessage().
+	/// Returns: >=0 (length of the body) on success, <0 on fail.
+	int readMessage(uint8_t msgIndex, sms_read_fn fn);
+	
+	/// readBody([fn], [timeIn]) - Read a message body, up to "\r\n", passing
+	/// it to [fn] - or storing it for getMessage() if [fn] is NULL. Gives up
+	/// SMS_COMMAND_TIMEOUT after [timeIn].
+	/// Returns: >=0 (length of the body) on success, <0 on fail.
+	int readBody(sms_read_fn fn, unsigned long timeIn);
+	
+	/// setIndication() - Send AT+CNMI for the _direct and _reports settings.
+	/// Returns: >0 on success, <0 on fail.
+	int8_t setIndication();
 };
 
 extern MG2639_SMS sms;
@@ -0,0 +1,373 @@
+/******************************************************************************
+MG2639_Server.cpp
+MG2639 Cellular Shield Library - TCP Server Functionality Source
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines TCP server functions of the
+MG2639. MG2639_Server, a friend class of MG2639_Cell, is defined with member
+functions like begin(), accept(), read(), write() and closePort().
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include "MG2639_Server.h"
+#include "MG2639_AT.h"
+#include <SFE_MG2639_CellShield.h>
+
+#define SERVER_RESPONSE_TIMEOUT	30000 // 30 second timeout on listen/send
+#define SERVER_HEADER_TIMEOUT	50 // Time allowed to receive a frame header
+
+MG2639_Server::MG2639_Server(MG2639_GPRS & modem)
+{
+	_gprs = &modem;
+	for (int i=0; i<SERVER_MAX_CONNECTIONS; i++)
+		_connections[i].channel = -1;
+	_port = 0;
+	_idleTimeout = SERVER_IDLE_TIMEOUT;
+	_activeChannel = -1;
+	_rxChannel = -1;
+	_rxRemaining = 0;
+}
+
+int MG2639_Server::begin(unsigned int port)
+{
+	int iRetVal;
+	// 11 for command, 2 for = and ',', 1 for on/off, 5 for port, 1 for NUL
+	char listenCmd[20];
+	memset(listenCmd, '\0', 20);
+	snprintf(listenCmd, 20, "%s=1,%u", SERVER_LISTEN, port);
+	_gprs->getCell().sendATCommand((const char *)listenCmd);
+	
+	iRetVal = _gprs->getCell().readWaitForResponses(RESPONSE_OK, RESPONSE_ERROR,
+	                                                SERVER_RESPONSE_TIMEOUT);
+	if (iRetVal > 0)
+		_port = port;
+	
+	return iRetVal;
+}
+
+int MG2639_Server::end()
+{
+	int iRetVal;
+	char listenCmd[17];
+	
+	// Close any open connections before we stop listening
+	flush();
+	while (_connections[0].channel >= 0)
+		closePort(_connections[0].channel);
+	
+	memset(listenCmd, '\0', 17);
+	sprintf(listenCmd, "%s=2,0", SERVER_LISTEN);
+	_gprs->getCell().sendATCommand((const char *)listenCmd);
+	iRetVal = _gprs->getCell().readWaitForResponses(RESPONSE_OK, RESPONSE_ERROR,
+	                                                COMMAND_RESPONSE_TIME);
+	
+	_port = 0;
+	
+	return iRetVal;
+}
+
+int MG2639_Server::setServerTimeout(unsigned int connectTimeout, unsigned int sendTimeout)
+{
+	int iRetVal;
+	// 11 for command, 2 for = and ',', 5 for connect, 5 for send, 1 for NUL
+	char timeoutCmd[24];
+	memset(timeoutCmd, '\0', 24);
+	snprintf(timeoutCmd, 24, "%s=%u,%u", SERVER_TIMEOUT, connectTimeout, sendTimeout);
+	_gprs->getCell().sendATCommand((const char *)timeoutCmd);
+	
+	iRetVal = _gprs->getCell().readWaitForResponses(RESPONSE_OK, RESPONSE_ERROR,
+	                                                COMMAND_RESPONSE_TIME);
+	return iRetVal;
+}
+
+void MG2639_Server::setIdleTimeout(unsigned long ms)
+{
+	_idleTimeout = ms;
+}
+
+int MG2639_Server::accept()
+{
+	poll();
+	
+	// Return the oldest connection accept() hasn't returned yet
+	for (int i=0; i<SERVER_MAX_CONNECTIONS; i++)
+	{
+		if ((_connections[i].channel >= 0) && !_connections[i].accepted)
+		{
+			_connections[i].accepted = true;
+			_activeChannel = _connections[i].channel;
+			return _activeChannel;
+		}
+	}
+	
+	return -1;
+}
+
+uint8_t MG2639_Server::connections()
+{
+	uint8_t count = 0;
+	for (int i=0; i<SERVER_MAX_CONNECTIONS; i++)
+	{
+		if (_connections[i].channel >= 0)
+			count++;
+	}
+	return count;
+}
+
+int MG2639_Server::channel()
+{
+	if (_rxRemaining == 0)
+		return -1;
+	return _rxChannel;
+}
+
+void MG2639_Server::setActiveChannel(uint8_t channel)
+{
+	_activeChannel = channel;
+}
+
+int8_t MG2639_Server::serverStatus(uint8_t channel)
+{
+	int iRetVal;
+	char statusCmd[18];
+	memset(statusCmd, '\0', 18);
+	sprintf(statusCmd, "%s=%d", SERVER_STATUS, channel);
+	_gprs->getCell().sendATCommand((const char *)statusCmd);
+	
+	// Response is "+ZTCPSTATUS(P):CONNECT" or "+ZTCPSTATUS(P):DISCONNECT".
+	// Look for the ':' so "DISCONNECT" doesn't match as "CONNECT".
+	iRetVal = _gprs->getCell().readWaitForResponses(":CONNECT", "DISCONNECT",
+	                                                COMMAND_RESPONSE_TIME);
+	
+	if (iRetVal > 0)
+		return GPRS_ESTABLISHED;
+	else if (iRetVal == ERROR_FAIL_RESPONSE)
+		return GPRS_DISCONNECTED;
+	
+	return iRetVal;
+}
+
+int MG2639_Server::closePort(uint8_t channel)
+{
+	int iRetVal;
+	int8_t slot;
+	char closeCmd[17];
+	memset(closeCmd, '\0', 17);
+	sprintf(closeCmd, "%s=%d", SERVER_CLOSE, channel);
+	_gprs->getCell().sendATCommand((const char *)closeCmd);
+	// Should respond "+ZTCPCLOSEP:OK\r\n\r\nOK\r\n"
+	iRetVal = _gprs->getCell().readWaitForResponses(RESPONSE_OK, RESPONSE_ERROR,
+	                                                COMMAND_RESPONSE_TIME);
+	
+	// Remove the connection from the accept queue, even if the close failed
+	// (most likely the remote end already closed it).
+	slot = findConnection(channel, false);
+	if (slot >= 0)
+	{
+		for (int i=slot; i<SERVER_MAX_CONNECTIONS - 1; i++)
+			_connections[i] = _connections[i + 1];
+		_connections[SERVER_MAX_CONNECTIONS - 1].channel = -1;
+	}
+	if (_activeChannel == channel)
+		_activeChannel = -1;
+	
+	return iRetVal;
+}
+
+int MG2639_Server::available()
+{
+	int uartAvailable;
+	
+	if (_rxRemaining == 0)
+		poll();
+	if (_rxRemaining == 0)
+		return 0;
+	
+	uartAvailable = _gprs->getCell().dataAvailable();
+	if ((unsigned int) uartAvailable > _rxRemaining)
+		return _rxRemaining;
+	
+	return uartAvailable;
+}
+
+int MG2639_Server::read()
+{
+	if (!available())
+		return -1;
+	
+	_rxRemaining--;
+	return _gprs->getCell().uartRead();
+}
+
+int MG2639_Server::peek()
+{
+	if (!available())
+		return -1;
+	
+	return _gprs->getCell().uartPeek();
+}
+
+void MG2639_Server::flush()
+{
+	unsigned long timeIn = millis();
+	
+	// The rest of the frame may still be on its way in from the module.
+	while (_rxRemaining && (timeIn + COMMAND_RESPONSE_TIME > millis()))
+	{
+		if (_gprs->getCell().dataAvailable())
+		{
+			_gprs->getCell().uartRead();
+			_rxRemaining--;
+		}
+	}
+	_rxRemaining = 0;
+}
+
+size_t MG2639_Server::write(uint8_t b)
+{
+	return write(&b, 1);
+}
+
+size_t MG2639_Server::write(const uint8_t *buf, size_t size)
+{
+	int iRetVal;
+	// 10 for command, 2 for '=' and ',', 3 for channel, 5 for length, 1 for NUL
+	char sendCmd[21];
+	
+	if (_activeChannel < 0)
+		return 0;
+	if (!_gprs->quotaAllows(size + USAGE_TCP_HEADER * 2))
+		return 0;
+	
+	memset(sendCmd, '\0', 21);
+	snprintf(sendCmd, 21, "%s=%d,%u", SERVER_SEND, _activeChannel, (unsigned int)size);
+	_gprs->getCell().sendATCommand((const char *)sendCmd);
+	iRetVal = _gprs->getCell().readWaitForResponses(">", RESPONSE_ERROR,
+	                                                SERVER_RESPONSE_TIMEOUT);
+	if (iRetVal <= 0)
+		return 0;
+	
+	_gprs->getCell().clearSerial(); // Clear out the serial rx buffer
+	_gprs->getCell().printString((const char *)buf, size); // Send the data
+	// The module triggers the send after <size>+1 characters, the extra
+	// one should be a carriage return.
+	_gprs->getCell().printChar('\r');
+	// Should respond "+ZTCPSEND(P):OK\r\n\r\nOK\r\n"
+	iRetVal = _gprs->getCell().readWaitForResponses(RESPONSE_OK, RESPONSE_ERROR,
+	                                                SERVER_RESPONSE_TIMEOUT);
+	if (iRetVal <= 0)
+		return 0;
+	
+	// Server channels aren't the same as client channels, so only the
+	// session and total are counted.
+	_gprs->countUsage(-1, size, 0, size + USAGE_TCP_HEADER, USAGE_TCP_HEADER);
+	
+	// Sending counts as activity too, or a connection that's only written
+	// to would be closed by closeIdle().
+	int8_t slot = findConnection(_activeChannel, false);
+	if (slot >= 0)
+		_connections[slot].lastActivity = millis();
+	
+	return size;
+}
+
+void MG2639_Server::poll()
+{
+	int iRetVal;
+	long rxChannel;
+	long length;
+	int8_t slot;
+	
+	if (_rxRemaining > 0)
+		return;
+	
+	closeIdle();
+	
+	if (!_gprs->getCell().dataAvailable())
+		return;
+	
+	// Data looks like "+ZTCPRECV(P):<channel>,<length>,<data>". A new
+	// connection may first be announced with "INCOMING CONNECT ACCEPTED",
+	// but that doesn't tell us the channel, so the connection is queued
+	// when its first data arrives.
+	iRetVal = _gprs->getCell().readWaitForResponses(SERVER_RECEIVE, SERVER_INCOMING,
+	                                                SERVER_HEADER_TIMEOUT);
+	if (iRetVal <= 0)
+		return;
+	
+	// readNumber() skips over the "(P):" before the channel
+	rxChannel = _gprs->getCell().readNumber(',', SERVER_HEADER_TIMEOUT);
+	if (rxChannel < 0)
+		return;
+	length = _gprs->getCell().readNumber(',', SERVER_HEADER_TIMEOUT);
+	if (length <= 0)
+		return;
+	
+	_rxChannel = rxChannel;
+	_rxRemaining = length;
+	_gprs->countUsage(-1, 0, length, USAGE_TCP_HEADER, length + USAGE_TCP_HEADER);
+	
+	slot = findConnection(_rxChannel, true);
+	if (slot < 0)
+	{
+		// The accept queue is full. Throw away the data and refuse the
+		// connection.
+		flush();
+		closePort(rxChannel);
+		return;
+	}
+	_connections[slot].lastActivity = millis();
+}
+
+int8_t MG2639_Server::findConnection(int8_t channel, bool add)
+{
+	for (int i=0; i<SERVER_MAX_CONNECTIONS; i++)
+	{
+		if (_connections[i].channel == channel)
+			return i;
+	}
+	
+	if (add)
+	{
+		for (int i=0; i<SERVER_MAX_CONNECTIONS; i++)
+		{
+			if (_connections[i].channel < 0)
+			{
+				_connections[i].channel = channel;
+				_connections[i].accepted = false;
+				_connections[i].lastActivity = millis();
+				return i;
+			}
+		}
+	}
+	
+	return -1;
+}
+
+void MG2639_Server::closeIdle()
+{
+	if (_idleTimeout == 0)
+		return;
+	
+	for (int i=0; i<SERVER_MAX_CONNECTIONS; i++)
+	{
+		if ((_connections[i].channel >= 0) && 
+		    (millis() - _connections[i].lastActivity > _idleTimeout))
+		{
+			closePort(_connections[i].channel);
+			i--; // closePort() shifted the queue down, check this slot again
+		}
+	}
+}
+
+MG2639_Server tcpServer;
@@ -0,0 +1,181 @@
+/******************************************************************************
+MG2639_Server.h
+MG2639 Cellular Shield Library - TCP Server Functionality Header
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines TCP server functions of the
+MG2639. MG2639_Server, a friend class of MG2639_Cell, is defined with member
+functions like begin(), accept(), read(), write() and closePort().
+
+The MG2639 can monitor one port at a time, and accepts at most two connections
+on that port. Data from those connections arrives as "+ZTCPRECV(P)" frames,
+tagged with a channel number. MG2639_Server strips that framing, so the
+payload can be read with the usual Stream functions - available(), read(),
+peek() - just like a UDP packet.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#ifndef _MG2639_SERVER_H_
+#define _MG2639_SERVER_H_
+
+#include <Stream.h>
+#include "MG2639_GPRS.h"
+
+// SERVER_MAX_CONNECTIONS - Size of the accept queue. The MG2639 only allows
+// two connections on a monitored port, more than that are closed on arrival.
+#define SERVER_MAX_CONNECTIONS 2
+
+// SERVER_IDLE_TIMEOUT - Default time (ms) a connection can go without
+// data either way before it's closed. Change it with setIdleTimeout().
+#define SERVER_IDLE_TIMEOUT 60000
+
+class MG2639_Server : public Stream
+{
+public:
+	/// MG2639_Server([modem]) - Constructor
+	/// Sets up class variables. Connections go through [modem] - the global gprs
+	/// if it's left out.
+	MG2639_Server(MG2639_GPRS & modem = gprs);
+	
+	//////////////////////////////
+	// Port Monitoring Commands //
+	//////////////////////////////
+	
+	/// begin([port]) - Start listening for connections on [port].
+	/// Sends the AT+ZTCPLISTEN=1,<port> command. gprs.open() must be called
+	/// before this function.
+	///
+	/// Returns: >0 on success, <0 on fail
+	int begin(unsigned int port);
+	
+	/// end() - Stop listening. Any open connections are closed first.
+	/// Sends the AT+ZTCPLISTEN=2,0 command.
+	///
+	/// Returns: >0 on success, <0 on fail
+	int end();
+	
+	/// setServerTimeout([connectTimeout], [sendTimeout]) - Set the module's
+	/// connect (5-120 s) and send (5-18000 s) timeouts. If data can't be sent
+	/// within [sendTimeout] the module closes the connection.
+	/// Sends the AT+ZIPTIMEOUT command.
+	///
+	/// Returns: >0 on success, <0 on fail
+	int setServerTimeout(unsigned int connectTimeout, unsigned int sendTimeout);
+	
+	/// setIdleTimeout([ms]) - Connections that don't send or receive anything
+	/// for [ms] milliseconds are closed by the library. 0 disables the idle timeout.
+	void setIdleTimeout(unsigned long ms);
+	
+	///////////////////////////
+	// Connection Management //
+	///////////////////////////
+	
+	/// accept() - Check for a new incoming connection. This is a polling
+	/// function - call it in loop() and call it often.
+	/// A connection is queued as soon as its first data arrives. accept()
+	/// returns the oldest queued connection and makes it the active channel,
+	/// which write() and print() send to.
+	///
+	/// Returns: channel of the accepted connection, -1 if none are waiting.
+	int accept();
+	
+	/// connections() - Returns the number of connections currently open.
+	uint8_t connections();
+	
+	/// channel() - Returns the channel the current data is from, or -1 if
+	/// there's no data being read.
+	int channel();
+	
+	/// setActiveChannel([channel]) - Select the connection write() sends to.
+	void setActiveChannel(uint8_t channel);
+	
+	/// serverStatus([channel]) - Checks if a passively opened link exists
+	/// on [channel]. Sends the AT+ZTCPSTATUSP command.
+	///
+	/// Returns: GPRS_ESTABLISHED (1) if connected, GPRS_DISCONNECTED (0)
+	/// if not, <0 on fail.
+	int8_t serverStatus(uint8_t channel);
+	
+	/// closePort([channel]) - Close a connection. Sends AT+ZTCPCLOSEP.
+	///
+	/// Returns: >0 on success, <0 on fail
+	int closePort(uint8_t channel);
+	
+	///////////////////////////
+	// Stream Data Interface //
+	///////////////////////////
+	
+	/// available() - Returns number of bytes of the current "+ZTCPRECV(P)"
+	/// frame that are ready to read. If there's no current frame, this
+	/// function checks for a new one.
+	virtual int available();
+	
+	/// read() - Read a byte of data from a connection.
+	///
+	/// Returns: The byte read, or -1 if no data is available.
+	virtual int read();
+	
+	/// peek() - Look at the next byte of data, but leave it in the buffer.
+	///
+	/// Returns: The next byte, or -1 if no data is available.
+	virtual int peek();
+	
+	/// flush() - Discard the rest of the current frame.
+	virtual void flush();
+	
+	/// write(b) - Send a single byte to the active channel.
+	///
+	/// Returns: >0 on success, 0 on fail.
+	virtual size_t write(uint8_t b);
+	
+	/// write([buf], [size]) - Send [size] bytes to the active channel.
+	/// Sends the AT+ZTCPSENDP command, then the data.
+	///
+	/// Returns: >0 on success, 0 on fail.
+	virtual size_t write(const uint8_t *buf, size_t size);
+	
+	using Print::write;
+
+private:
+	MG2639_GPRS * _gprs;
+	// Accept queue. Connections are stored in the order they were seen.
+	struct server_connection {
+		int8_t channel; // -1 if this slot is empty
+		bool accepted; // Has accept() returned this connection yet?
+		unsigned long lastActivity; // millis() of the last data sent or received
+	};
+	server_connection _connections[SERVER_MAX_CONNECTIONS];
+	
+	unsigned int _port; // Port being monitored, 0 if not listening
+	unsigned long _idleTimeout;
+	int8_t _activeChannel; // Channel write() sends to
+	
+	// Channel and bytes left to read of the current "+ZTCPRECV(P)" frame
+	int8_t _rxChannel;
+	unsigned int _rxRemaining;
+	
+	/// poll() - Check the UART for a new frame, and close idle connections.
+	void poll();
+	
+	/// findConnection([channel]) - Get the accept queue slot of a channel.
+	/// If [add] is true and the channel isn't in the queue, it's added.
+	/// Returns: slot index, or -1 if not found (or the queue is full).
+	int8_t findConnection(int8_t channel, bool add);
+	
+	/// closeIdle() - Close any connection idle for more than _idleTimeout.
+	void closeIdle();
+};
+
+extern MG2639_Server tcpServer;
+
+#endif
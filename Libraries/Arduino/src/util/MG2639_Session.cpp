@@ -0,0 +1,235 @@
+/******************************************************************************
+MG2639_Session.cpp
+MG2639 Cellular Shield Library - GPRS Session Manager Source
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines a non-blocking GPRS session
+manager. MG2639_Session, a friend class of MG2639_Cell, opens the GPRS (PPP)
+connection in the background - one step per call to update() - and retries
+with exponential backoff when it fails.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include "MG2639_Session.h"
+#include "MG2639_AT.h"
+#include <SFE_MG2639_CellShield.h>
+
+// Backoff doubles on every failure, up to 2^SESSION_BACKOFF_SHIFT_MAX times
+// the base. SESSION_BACKOFF_MAX still caps the result.
+#define SESSION_BACKOFF_SHIFT_MAX 8
+
+MG2639_Session::MG2639_Session(MG2639_GPRS & modem)
+{
+	_gprs = &modem;
+	_state = SESSION_IDLE;
+	_stateTime = 0;
+	_startTime = 0;
+	_lastCheck = 0;
+	_waiting = false;
+	_checkInterval = SESSION_CHECK_INTERVAL;
+	_backoff = 0;
+	_connectTime = 0;
+	_retries = 0;
+	_totalRetries = 0;
+}
+
+void MG2639_Session::begin()
+{
+	_retries = 0;
+	_totalRetries = 0;
+	_connectTime = 0;
+	_backoff = 0;
+	_startTime = millis();
+	_lastCheck = 0;
+	_waiting = false;
+	setState(SESSION_REGISTERING);
+}
+
+int MG2639_Session::end()
+{
+	_waiting = false;
+	setState(SESSION_IDLE);
+	return _gprs->close();
+}
+
+void MG2639_Session::setCheckInterval(unsigned long ms)
+{
+	_checkInterval = ms;
+}
+
+session_state MG2639_Session::update()
+{
+	int8_t iRetVal;
+	
+	switch (_state)
+	{
+	case SESSION_REGISTERING:
+		if (!_waiting)
+		{
+			// Don't flood the module with registration checks
+			if ((_lastCheck != 0) && (millis() - _lastCheck < SESSION_REGISTRATION_INTERVAL))
+				break;
+			_lastCheck = millis();
+			// Send "AT+CREG?", and read the response on later calls
+			_gprs->getCell().sendATCommand(CHECK_REGISTRATION);
+			_gprs->getCell().clearBuffer();
+			_waiting = true;
+			break;
+		}
+		iRetVal = readResponse(RESPONSE_OK, RESPONSE_ERROR, COMMAND_RESPONSE_TIME);
+		if (iRetVal == 0)
+			break;
+		_waiting = false;
+		if ((iRetVal < 0) || !isRegistered())
+		{
+			// Registration can take a while after power on. Only count it
+			// as a failure if it takes longer than an open would.
+			if (millis() - _stateTime > SESSION_OPEN_TIMEOUT)
+				fail();
+			break;
+		}
+		// Registered! Send AT+ZPPPOPEN, but don't wait for the response.
+		_gprs->getCell().sendATCommand(OPEN_GPRS);
+		_gprs->getCell().clearBuffer();
+		setState(SESSION_OPENING);
+		break;
+	
+	case SESSION_OPENING:
+		// Should respond "+ZPPPOPEN:CONNECTED\r\n\r\nOK\r\n\r\n" or
+		//				  "+ZPPPOPEN:ESTABLISHED\r\n\r\nOK\r\n\r\n"
+		// Bad response is "+ZPPPOPEN:FAIL\r\n\r\nERROR\r\n"
+		while (_gprs->getCell().dataAvailable())
+		{
+			_gprs->getCell().readByteToBuffer();
+			if (_gprs->getCell().searchBuffer(RESPONSE_OK))
+			{
+				_connectTime = millis() - _startTime;
+				_retries = 0;
+				_lastCheck = millis();
+				setState(SESSION_READY);
+				return _state;
+			}
+			if (_gprs->getCell().searchBuffer(RESPONSE_ERROR))
+			{
+				fail();
+				return _state;
+			}
+		}
+		if (millis() - _stateTime > SESSION_OPEN_TIMEOUT)
+			fail();
+		break;
+	
+	case SESSION_READY:
+		if (!_waiting)
+		{
+			if ((_checkInterval == 0) || (millis() - _lastCheck < _checkInterval))
+				break;
+			_lastCheck = millis();
+			// Send the link check (as gprs.status() does), and read the
+			// response on later calls
+			_gprs->getCell().sendATCommand(TCP_STATUS);
+			_gprs->getCell().clearBuffer();
+			_waiting = true;
+			break;
+		}
+		iRetVal = readResponse("ESTABLISHED", "DISCONNECTED", SESSION_STATUS_TIMEOUT);
+		if (iRetVal == 0)
+			break;
+		_waiting = false;
+		// A timeout isn't taken as a drop - the next check will tell.
+		if (iRetVal == ERROR_FAIL_RESPONSE)
+		{
+			// The link dropped. Start over, timing the reconnect.
+			_startTime = millis();
+			_lastCheck = 0;
+			setState(SESSION_REGISTERING);
+		}
+		break;
+	
+	case SESSION_BACKOFF:
+		if (millis() - _stateTime >= _backoff)
+		{
+			_lastCheck = 0;
+			setState(SESSION_REGISTERING);
+		}
+		break;
+	
+	case SESSION_IDLE:
+	default:
+		break;
+	}
+	
+	return _state;
+}
+
+void MG2639_Session::setState(session_state state)
+{
+	_state = state;
+	_stateTime = millis();
+}
+
+int8_t MG2639_Session::readResponse(const char * goodRsp, const char * failRsp,
+                                    unsigned int timeout)
+{
+	// Only read what's already arrived, so update() never waits on the UART
+	while (_gprs->getCell().dataAvailable())
+	{
+		_gprs->getCell().readByteToBuffer();
+		if (_gprs->getCell().searchBuffer(goodRsp))
+			return 1;
+		if (_gprs->getCell().searchBuffer(failRsp))
+			return ERROR_FAIL_RESPONSE;
+	}
+	if (millis() - _lastCheck > timeout)
+		return ERROR_TIMEOUT;
+	
+	return 0;
+}
+
+bool MG2639_Session::isRegistered()
+{
+	char * ptr;
+	
+	// Response looks like "+CREG: 0,1\r\n\r\nOK\r\n". The second value is
+	// 1 if registered on the home network, 5 if roaming.
+	ptr = _gprs->getCell().searchBuffer("+CREG: ");
+	if (ptr == NULL)
+		return false;
+	ptr = strchr(ptr, ',');
+	if (ptr == NULL)
+		return false;
+	
+	return (ptr[1] == '1') || (ptr[1] == '5');
+}
+
+void MG2639_Session::fail()
+{
+	unsigned long backoff;
+	uint8_t shift;
+	
+	_retries++;
+	_totalRetries++;
+	
+	// Exponential backoff: base * 2^(retries - 1), capped at the max.
+	shift = (_retries - 1 < SESSION_BACKOFF_SHIFT_MAX) ? _retries - 1 : SESSION_BACKOFF_SHIFT_MAX;
+	backoff = (unsigned long) SESSION_BACKOFF_BASE << shift;
+	if (backoff > SESSION_BACKOFF_MAX)
+		backoff = SESSION_BACKOFF_MAX;
+	// Add up to 50% jitter, so a fleet of devices that lost coverage at
+	// the same time don't all retry at the same time.
+	_backoff = (backoff / 2) + random(backoff / 2 + 1);
+	
+	setState(SESSION_BACKOFF);
+}
+
+MG2639_Session gprsSession;
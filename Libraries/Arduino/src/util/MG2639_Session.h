@@ -0,0 +1,151 @@
+/******************************************************************************
+MG2639_Session.h
+MG2639 Cellular Shield Library - GPRS Session Manager Header
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines a non-blocking GPRS session
+manager. MG2639_Session, a friend class of MG2639_Cell, opens the GPRS (PPP)
+connection in the background - one step per call to update() - and retries
+with exponential backoff when it fails.
+
+Instead of blocking for up to 30 seconds in gprs.open(), a sketch calls
+gprsSession.begin() once, then gprsSession.update() every time through
+loop(), and checks gprsSession.isReady() before using TCP or UDP.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#ifndef _MG2639_SESSION_H_
+#define _MG2639_SESSION_H_
+
+#include <Arduino.h>
+#include "MG2639_GPRS.h"
+
+// Timing of the session state machine. All values in milliseconds.
+#define SESSION_REGISTRATION_INTERVAL	2000 // Time between AT+CREG? checks
+#define SESSION_OPEN_TIMEOUT	30000 // Max time to wait for AT+ZPPPOPEN
+#define SESSION_CHECK_INTERVAL	60000 // Time between link checks once ready
+#define SESSION_STATUS_TIMEOUT	30000 // Max time to wait for a link check
+#define SESSION_BACKOFF_BASE	2000 // Backoff after the first failure
+#define SESSION_BACKOFF_MAX		300000 // Backoff will never be longer than this
+
+// session_state enumerates the states of the session state machine:
+// 0: SESSION_IDLE - Not started, or stopped with end()
+// 1: SESSION_REGISTERING - Waiting for the module to register on the network
+// 2: SESSION_OPENING - AT+ZPPPOPEN sent, waiting for the response
+// 3: SESSION_READY - GPRS is open, TCP and UDP can be used
+// 4: SESSION_BACKOFF - Waiting to retry after a failure
+enum session_state {
+	SESSION_IDLE,
+	SESSION_REGISTERING,
+	SESSION_OPENING,
+	SESSION_READY,
+	SESSION_BACKOFF
+};
+
+class MG2639_Session
+{
+public:
+	/// MG2639_Session([modem]) - Constructor
+	/// Sets up class variables. Commands go through [modem] - the global gprs
+	/// if it's left out.
+	MG2639_Session(MG2639_GPRS & modem = gprs);
+	
+	/// begin() - Start bringing up the GPRS connection. Nothing is sent to
+	/// the module until the next call to update().
+	void begin();
+	
+	/// end() - Stop the session manager and close the GPRS connection.
+	///
+	/// Returns: >0 on success, <0 on fail
+	int end();
+	
+	/// update() - Run one step of the session state machine. This is a
+	/// polling function - call it in loop() and call it often. It never
+	/// waits for the module: commands are sent on one call, and their
+	/// responses read as they arrive on later calls.
+	/// While the session is SESSION_OPENING, or isBusy(), update() consumes
+	/// the module's responses. Don't send other commands (SMS, phone, etc.)
+	/// until it's ready and not busy, or backing off.
+	///
+	/// Returns: The current session_state.
+	session_state update();
+	
+	/// isReady() - Returns true if GPRS is open, and update() isn't waiting
+	/// for a link check's response. Doesn't block.
+	inline bool isReady() { return (_state == SESSION_READY) && !_waiting; };
+	
+	/// state() - Returns the current session_state.
+	inline session_state state() { return _state; };
+	
+	/// isBusy() - Returns true while update() is waiting for the response to
+	/// a registration or link check.
+	inline bool isBusy() { return _waiting; };
+	
+	/// setCheckInterval([ms]) - Once ready, the link is checked (as
+	/// gprs.status() does) every [ms] milliseconds. 0 disables the check.
+	void setCheckInterval(unsigned long ms);
+	
+	////////////////////////
+	// Session Statistics //
+	////////////////////////
+	
+	/// getConnectTime() - Returns the time (ms) from begin() - or the link
+	/// dropping - until GPRS was last opened. 0 if it hasn't opened yet.
+	inline unsigned long getConnectTime() { return _connectTime; };
+	
+	/// getRetries() - Returns the number of failed attempts since the last
+	/// successful open (or total, if it has never opened).
+	inline unsigned int getRetries() { return _retries; };
+	
+	/// getTotalRetries() - Returns the number of failed attempts since
+	/// begin().
+	inline unsigned long getTotalRetries() { return _totalRetries; };
+	
+	/// getBackoff() - Returns the current backoff delay (ms), including
+	/// jitter.
+	inline unsigned long getBackoff() { return _backoff; };
+
+private:
+	MG2639_GPRS * _gprs;
+	session_state _state;
+	unsigned long _stateTime; // millis() when we entered the current state
+	unsigned long _startTime; // millis() when we started connecting
+	unsigned long _lastCheck; // millis() of the last registration/link check
+	bool _waiting; // Is a check's response still to be read?
+	unsigned long _checkInterval;
+	unsigned long _backoff;
+	unsigned long _connectTime;
+	unsigned int _retries;
+	unsigned long _totalRetries;
+	
+	/// setState([state]) - Move to [state] and timestamp the change.
+	void setState(session_state state);
+	
+	/// readResponse([goodRsp], [failRsp], [timeout]) - Read whatever the
+	/// module has sent into rxBuffer, without waiting for more.
+	/// Returns: 1 if [goodRsp] was read, ERROR_FAIL_RESPONSE if [failRsp]
+	/// was, ERROR_TIMEOUT if neither came within [timeout] ms of the check,
+	/// 0 if the response isn't complete yet.
+	int8_t readResponse(const char * goodRsp, const char * failRsp, unsigned int timeout);
+	
+	/// isRegistered() - Parse an AT+CREG? response in rxBuffer.
+	/// Returns: true if registered (home or roaming).
+	bool isRegistered();
+	
+	/// fail() - Record a failed attempt and start backing off.
+	void fail();
+};
+
+extern MG2639_Session gprsSession;
+
+#endif
@@ -0,0 +1,57 @@
+/******************************************************************************
+MG2639_Storage.cpp
+MG2639 Cellular Shield Library - Non-Volatile Storage Interface Source
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines MG2639_Storage, the
+byte-addressed non-volatile storage used by MG2639_Queue and
+MG2639_Download, and MG2639_EEPROMStorage, which uses the AVR's EEPROM.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include "MG2639_Storage.h"
+#if defined(__AVR__)
+#include <avr/eeprom.h>
+#endif
+
+void MG2639_Storage::writeBlock(unsigned long address, const uint8_t * data,
+                                unsigned int length)
+{
+	for (unsigned int i = 0; i < length; i++)
+		write(address + i, data[i]);
+}
+
+#if defined(__AVR__)
+MG2639_EEPROMStorage::MG2639_EEPROMStorage(unsigned int start, unsigned int length)
+{
+	_start = start;
+	_length = length;
+}
+
+uint8_t MG2639_EEPROMStorage::read(unsigned long address)
+{
+	return eeprom_read_byte((uint8_t *) (_start + (unsigned int) address));
+}
+
+void MG2639_EEPROMStorage::write(unsigned long address, uint8_t value)
+{
+	// eeprom_update_byte skips the write (and the wear) if the value
+	// is already there.
+	eeprom_update_byte((uint8_t *) (_start + (unsigned int) address), value);
+}
+
+unsigned long MG2639_EEPROMStorage::size()
+{
+	return _length;
+}
+#endif
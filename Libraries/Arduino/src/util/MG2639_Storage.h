@@ -0,0 +1,71 @@
+/******************************************************************************
+MG2639_Storage.h
+MG2639 Cellular Shield Library - Non-Volatile Storage Interface Header
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines MG2639_Storage, the
+byte-addressed non-volatile storage used by MG2639_Queue and
+MG2639_Download. MG2639_EEPROMStorage keeps data in the AVR's internal
+EEPROM. For external flash, an SD card, or a file on a host, derive a class
+from MG2639_Storage.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#ifndef _MG2639_STORAGE_H_
+#define _MG2639_STORAGE_H_
+
+#include <Arduino.h>
+
+class MG2639_Storage
+{
+public:
+	/// read([address]) - Read a byte from [address].
+	virtual uint8_t read(unsigned long address) = 0;
+	
+	/// write([address], [value]) - Write a byte to [address]. The byte must be
+	/// in non-volatile storage by the time commit() returns.
+	virtual void write(unsigned long address, uint8_t value) = 0;
+	
+	/// writeBlock([address], [data], [length]) - Write [length] bytes to
+	/// [address]. Override this if your storage is faster in blocks (SD
+	/// cards, flash pages) - by default it calls write() for each byte.
+	virtual void writeBlock(unsigned long address, const uint8_t * data,
+	                        unsigned int length);
+	
+	/// commit() - Make all previous writes persistent. Only needed for
+	/// storage that caches writes (flash pages, files).
+	virtual void commit() {};
+	
+	/// size() - Number of bytes available.
+	virtual unsigned long size() = 0;
+};
+
+#if defined(__AVR__)
+/// MG2639_EEPROMStorage - MG2639_Storage in the AVR's internal EEPROM.
+/// [start] and [length] select the part of EEPROM that can be used.
+/// e.g.: MG2639_EEPROMStorage storage(0, 512); // Use the first 512 bytes
+class MG2639_EEPROMStorage : public MG2639_Storage
+{
+public:
+	MG2639_EEPROMStorage(unsigned int start, unsigned int length);
+	virtual uint8_t read(unsigned long address);
+	virtual void write(unsigned long address, uint8_t value);
+	virtual unsigned long size();
+
+private:
+	unsigned int _start;
+	unsigned int _length;
+};
+#endif
+
+#endif
@@ -0,0 +1,282 @@
+/******************************************************************************
+MG2639_UDP.cpp
+MG2639 Cellular Shield Library - UDP Functionality Source
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines UDP functions of the
+MG2639. MG2639_UDP, a friend class of MG2639_Cell, is defined with member
+functions like beginPacket(), write(), endPacket() and parsePacket().
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#include "MG2639_UDP.h"
+#include "MG2639_AT.h"
+#include <SFE_MG2639_CellShield.h>
+
+#define UDP_RESPONSE_TIMEOUT	30000 // 30 second timeout on link setup/send
+#define UDP_HEADER_TIMEOUT		50 // Time allowed to receive a +ZIPRECVU header
+
+MG2639_UDP::MG2639_UDP(MG2639_GPRS & modem)
+{
+	_gprs = &modem;
+	_activeChannel = -1;
+	_remotePort = 0;
+	_txLength = 0;
+	_rxRemaining = 0;
+}
+
+int MG2639_UDP::begin(IPAddress ip, unsigned int port, uint8_t channel)
+{
+	int iRetVal;
+	// Maximum is 15 for IP + 5 for port + 1 for channel + 13 for cmd, = and ,'s
+	char udpSetupCmd[35];
+	memset(udpSetupCmd, '\0', 35);
+	sprintf(udpSetupCmd, "%s=%d,%d.%d.%d.%d,%u", UDP_SETUP, channel, 
+	        ip[0], ip[1], ip[2], ip[3], port);
+	_gprs->getCell().sendATCommand((const char *)udpSetupCmd);
+	
+	// Response is "OK" once the link is bound, "ERROR" if GPRS isn't open.
+	iRetVal = _gprs->getCell().readWaitForResponses(RESPONSE_OK, RESPONSE_ERROR,
+	                                                UDP_RESPONSE_TIMEOUT);
+	if (iRetVal <= 0)
+		return iRetVal;
+	
+	_activeChannel = channel;
+	_remoteIP = ip;
+	_remotePort = port;
+	if (channel < USAGE_CHANNELS)
+		memset(&_gprs->_channelUsage[channel], 0, sizeof(gprs_usage));
+	
+	return iRetVal;
+}
+
+int MG2639_UDP::stop()
+{
+	int iRetVal;
+	char closeCmd[14];
+	
+	if (_activeChannel < 0)
+		return SUCCESS_OK;
+	
+	memset(closeCmd, '\0', 14);
+	sprintf(closeCmd, "%s=%d", UDP_CLOSE, _activeChannel);
+	_gprs->getCell().sendATCommand((const char *)closeCmd);
+	// Should respond "+ZIPCLOSE:OK\r\n\r\nOK\r\n"
+	iRetVal = _gprs->getCell().readWaitForResponses(RESPONSE_OK, RESPONSE_ERROR,
+	                                                COMMAND_RESPONSE_TIME);
+	
+	_activeChannel = -1;
+	_remotePort = 0;
+	
+	return iRetVal;
+}
+
+int8_t MG2639_UDP::status()
+{
+	int iRetVal;
+	char statusCmd[15];
+	
+	memset(statusCmd, '\0', 15);
+	sprintf(statusCmd, "%s=%d", UDP_STATUS, _activeChannel);
+	_gprs->getCell().sendATCommand((const char *)statusCmd);
+	iRetVal = _gprs->getCell().readWaitForResponses("ESTABLISHED", "DISCONNECTED",
+	                                                COMMAND_RESPONSE_TIME);
+	
+	if (iRetVal > 0)
+		return GPRS_ESTABLISHED;
+	else if (iRetVal == ERROR_FAIL_RESPONSE)
+		return GPRS_DISCONNECTED;
+	
+	return iRetVal;
+}
+
+int MG2639_UDP::beginPacket(IPAddress ip, unsigned int port)
+{
+	int iRetVal = SUCCESS_OK;
+	
+	_txLength = 0;
+	
+	// Only set up a new link if the destination has changed. Re-using the
+	// bound link saves a command/response round trip on every packet.
+	if ((_activeChannel < 0) || (_remotePort != port) || !(_remoteIP == ip))
+	{
+		uint8_t channel = (_activeChannel < 0) ? DEFAULT_CHANNEL : _activeChannel;
+		if (_activeChannel >= 0)
+			stop();
+		iRetVal = begin(ip, port, channel);
+	}
+	
+	return iRetVal;
+}
+
+int MG2639_UDP::beginPacket(const char * domain, unsigned int port)
+{
+	int iRetVal;
+	IPAddress destIP;
+	
+	iRetVal = _gprs->hostByName(domain, &destIP);
+	if (iRetVal <= 0)
+		return iRetVal;
+	
+	return beginPacket(destIP, port);
+}
+
+size_t MG2639_UDP::write(uint8_t b)
+{
+	return write(&b, 1);
+}
+
+size_t MG2639_UDP::write(const uint8_t *buf, size_t size)
+{
+	// Copy as much as will fit into the packet buffer
+	if (size > UDP_TX_BUFFER_SIZE - _txLength)
+		size = UDP_TX_BUFFER_SIZE - _txLength;
+	memcpy(_txBuffer + _txLength, buf, size);
+	_txLength += size;
+	
+	return size;
+}
+
+int MG2639_UDP::endPacket()
+{
+	int iRetVal;
+	// Maximum is 9 for command, '=' and ',', 1 for channel, 4 for length
+	char sendCmd[16];
+	
+	if (_activeChannel < 0)
+		return ERROR_FAIL_RESPONSE;
+	if (!_gprs->quotaAllows(_txLength + USAGE_UDP_HEADER))
+		return ERROR_OVERRUN_PREVENT;
+	
+	memset(sendCmd, '\0', 16);
+	sprintf(sendCmd, "%s=%d,%u", UDP_SEND, _activeChannel, _txLength);
+	_gprs->getCell().sendATCommand((const char *)sendCmd);
+	iRetVal = _gprs->getCell().readWaitForResponses(">", RESPONSE_ERROR,
+	                                                UDP_RESPONSE_TIMEOUT);
+	if (iRetVal <= 0)
+		return iRetVal;
+	
+	_gprs->getCell().clearSerial(); // Clear out the serial rx buffer
+	_gprs->getCell().printString((const char *)_txBuffer, _txLength); // Send the packet
+	// Should respond "+ZIPSENDU:OK\r\n\r\nOK\r\n"
+	iRetVal = _gprs->getCell().readWaitForResponses(RESPONSE_OK, RESPONSE_ERROR,
+	                                                UDP_RESPONSE_TIMEOUT);
+	if (iRetVal > 0) // No ACK for UDP
+		_gprs->countUsage(_activeChannel, _txLength, 0, _txLength + USAGE_UDP_HEADER, 0);
+	_txLength = 0;
+	
+	return iRetVal;
+}
+
+int MG2639_UDP::parsePacket()
+{
+	int iRetVal;
+	long channel;
+	long length;
+	
+	flush(); // Throw away anything left from the previous packet
+	
+	if (!_gprs->getCell().dataAvailable())
+		return 0;
+	
+	// Incoming data looks like: "+ZIPRECVU:1,5,abcde"
+	iRetVal = _gprs->getCell().readWaitForResponse(UDP_RECEIVE, UDP_HEADER_TIMEOUT);
+	if (iRetVal <= 0)
+		return 0;
+	
+	// Read the channel, then the length
+	channel = _gprs->getCell().readNumber(',', UDP_HEADER_TIMEOUT);
+	if (channel < 0)
+		return 0;
+	length = _gprs->getCell().readNumber(',', UDP_HEADER_TIMEOUT);
+	if (length <= 0)
+		return 0;
+	
+	_rxRemaining = length;
+	_gprs->countUsage(channel, 0, length, 0, length + USAGE_UDP_HEADER);
+	
+	return length;
+}
+
+int MG2639_UDP::available()
+{
+	int uartAvailable;
+	
+	if (_rxRemaining == 0)
+		return 0;
+	
+	uartAvailable = _gprs->getCell().dataAvailable();
+	if ((unsigned int) uartAvailable > _rxRemaining)
+		return _rxRemaining;
+	
+	return uartAvailable;
+}
+
+int MG2639_UDP::read()
+{
+	if (!available())
+		return -1;
+	
+	_rxRemaining--;
+	return _gprs->getCell().uartRead();
+}
+
+int MG2639_UDP::read(unsigned char * buf, size_t len)
+{
+	size_t i;
+	for (i = 0; i < len; i++)
+	{
+		int c = read();
+		if (c < 0)
+			break;
+		buf[i] = c;
+	}
+	
+	return i;
+}
+
+int MG2639_UDP::peek()
+{
+	if (!available())
+		return -1;
+	
+	return _gprs->getCell().uartPeek();
+}
+
+void MG2639_UDP::flush()
+{
+	unsigned long timeIn = millis();
+	
+	// The rest of the packet may still be on its way in from the module.
+	while (_rxRemaining && (timeIn + COMMAND_RESPONSE_TIME > millis()))
+	{
+		if (_gprs->getCell().dataAvailable())
+		{
+			_gprs->getCell().uartRead();
+			_rxRemaining--;
+		}
+	}
+	_rxRemaining = 0;
+}
+
+IPAddress MG2639_UDP::remoteIP()
+{
+	return _remoteIP;
+}
+
+unsigned int MG2639_UDP::remotePort()
+{
+	return _remotePort;
+}
+
+MG2639_UDP udp;
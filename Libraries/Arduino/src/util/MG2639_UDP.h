@@ -0,0 +1,177 @@
+/******************************************************************************
+MG2639_UDP.h
+MG2639 Cellular Shield Library - UDP Functionality Header
+Original Creation Date: October 19, 2026
+https://github.com/sparkfun/MG2639_Cellular_Shield
+
+This library within SFE_MG2639_CellShield defines UDP functions of the
+MG2639. MG2639_UDP, a friend class of MG2639_Cell, is defined with member
+functions like beginPacket(), write(), endPacket() and parsePacket().
+
+UDP is a better fit than TCP for small, loss-tolerant readings. Per reading,
+with IPv4 and no TCP options, the two compare roughly like this:
+
+	             | Bytes on air     | Network round trips | UART traffic
+	-------------+------------------+---------------------+---------------------
+	TCP (connect,| ~320 + payload   | >= 2 (handshake,    | ZIPSETUP, ZIPSEND
+	 send, close)| (3-way handshake,| send ACK) before    | and their responses
+	             | data + ACK,      | the send returns    | (~100 chars)
+	             | FIN/ACK x2)      |                     |
+	UDP (bound   | 28 + payload     | 0 - endPacket()     | ZIPSENDU and its
+	 link, send) | (IP + UDP header)| returns once the    | response (~35 chars)
+	             |                  | module accepts data |
+
+The UDP link is set up once (AT+ZIPSETUPU) and re-used for every packet sent
+to the same destination, so the setup cost is only paid when the destination
+changes.
+
+Development environment specifics:
+	IDE: Arduino 1.6.3
+	Hardware Platform: Arduino Uno
+	MG2639 Cellular Shield Version: 1.0
+
+This code is beerware; if you see me (or any other SparkFun employee) at the
+local, and you've found our code helpful, please buy us a round!
+
+Distributed as-is; no warranty is given.
+******************************************************************************/
+
+#ifndef _MG2639_UDP_H_
+#define _MG2639_UDP_H_
+
+#include <Stream.h>
+#include <IPAddress.h>
+#include "MG2639_GPRS.h"
+
+// UDP_TX_BUFFER_SIZE - Maximum size of a packet built with beginPacket(),
+// write() and endPacket(). The MG2639 supports up to 1000 bytes per send, but
+// SRAM is precious. Increase this if you need to send larger packets.
+#define UDP_TX_BUFFER_SIZE 64
+
+class MG2639_UDP : public Stream
+{
+public:
+	/// MG2639_UDP([modem]) - Constructor
+	/// Sets up class variables. Packets go through [modem] - the global gprs
+	/// if it's left out.
+	MG2639_UDP(MG2639_GPRS & modem = gprs);
+	
+	///////////////////////
+	// UDP Link Commands //
+	///////////////////////
+	
+	/// begin([ip], [port], [channel]) - Set up a UDP link to a specified
+	/// [ip] address and [port]. Sends the AT+ZIPSETUPU command.
+	/// gprs.open() must be called before this function.
+	/// [channel] defaults to 0. If you only need one link open at a time,
+	/// this variable can be ignored.
+	///
+	/// Returns: >0 on success, <0 on fail
+	int begin(IPAddress ip, unsigned int port, uint8_t channel = DEFAULT_CHANNEL);
+	
+	/// stop() - Close the active UDP link. Sends the AT+ZIPCLOSEU command.
+	///
+	/// Returns: >0 on success, <0 on fail
+	int stop();
+	
+	/// status() - Checks the status of the active UDP link. Sends the
+	/// AT+ZIPSTATUSU command.
+	///
+	/// Returns: GPRS_ESTABLISHED (1) if the link is up, GPRS_DISCONNECTED (0)
+	/// if it's down, <0 on fail.
+	int8_t status();
+	
+	/////////////////////
+	// Sending Packets //
+	/////////////////////
+	
+	/// beginPacket([ip], [port]) - Start building a packet to send to [ip] on
+	/// [port]. If a UDP link to that destination isn't already set up, this
+	/// function will call begin() to set it up.
+	///
+	/// Returns: >0 on success, <0 on fail
+	int beginPacket(IPAddress ip, unsigned int port);
+	
+	/// beginPacket([domain], [port]) - Start building a packet to send to
+	/// [domain] on [port]. The IP is looked up with gprs.hostByName().
+	///
+	/// Returns: >0 on success, <0 on fail
+	int beginPacket(const char * domain, unsigned int port);
+	
+	/// write(b) - Add a single byte to the packet being built.
+	///
+	/// Returns: 1 on success, 0 if the packet is full.
+	virtual size_t write(uint8_t b);
+	
+	/// write([buf], [size]) - Add [size] bytes to the packet being built.
+	/// Bytes beyond UDP_TX_BUFFER_SIZE are dropped.
+	///
+	/// Returns: Number of bytes added to the packet.
+	virtual size_t write(const uint8_t *buf, size_t size);
+	
+	using Print::write;
+	
+	/// endPacket() - Send the packet built since beginPacket().
+	/// This function sends the "AT+ZIPSENDU" command, then the packet data.
+	///
+	/// Returns: >0 on success, <0 on fail.
+	int endPacket();
+	
+	///////////////////////
+	// Receiving Packets //
+	///////////////////////
+	
+	/// parsePacket() - Check for a "+ZIPRECVU" packet from the MG2639.
+	/// This is a polling function - call it in loop() and call it often.
+	/// Any unread data from the previous packet is discarded.
+	///
+	/// Returns: Size of the received packet, 0 if nothing was received.
+	int parsePacket();
+	
+	/// available() - Returns number of bytes left to read in the current
+	/// packet that have arrived in the UART RX buffer.
+	virtual int available();
+	
+	/// read() - Read a byte from the current packet.
+	///
+	/// Returns: The byte read, or -1 if no data is available.
+	virtual int read();
+	
+	/// read([buf], [len]) - Read up to [len] bytes of the current packet
+	/// into [buf].
+	///
+	/// Returns: Number of bytes read.
+	int read(unsigned char * buf, size_t len);
+	
+	/// peek() - Look at the next byte of the current packet, but leave it
+	/// in the buffer.
+	///
+	/// Returns: The next byte, or -1 if no data is available.
+	virtual int peek();
+	
+	/// flush() - Discard the rest of the current packet.
+	virtual void flush();
+	
+	/// remoteIP() and remotePort() - The destination the active UDP link
+	/// is set up to. The MG2639 only delivers packets from that host.
+	IPAddress remoteIP();
+	unsigned int remotePort();
+
+private:
+	MG2639_GPRS * _gprs;
+	// Keep track of the active channel and the destination it's linked to.
+	int8_t _activeChannel;
+	IPAddress _remoteIP;
+	unsigned int _remotePort;
+	
+	// Packet being built between beginPacket() and endPacket()
+	uint8_t _txBuffer[UDP_TX_BUFFER_SIZE];
+	unsigned int _txLength;
+	
+	// Number of bytes of the current received packet left to read
+	unsigned int _rxRemaining;
+};
+
+extern MG2639_UDP udp;
+
+#endif